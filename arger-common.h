@@ -11,11 +11,31 @@
 #include <variant>
 #include <optional>
 #include <set>
+#include <span>
+#include <array>
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <typeinfo>
+#include <limits>
+#include <type_traits>
+#include <mutex>
+#include <atomic>
+#include <chrono>
 
 namespace arger {
 	class Parsed;
 	class Arguments;
+	class Enum;
+	class CompiledConfig;
+	struct StaticConfig;
+	template <const arger::StaticConfig& Config>
+	class StaticParsed;
+	template <const arger::StaticConfig& Config, bool Menu>
+	class StaticCompiled;
+	class CompiledImage;
 	namespace detail {
+		template <class ChType>
 		class Parser;
 	}
 
@@ -26,11 +46,22 @@ namespace arger {
 		real,
 		boolean
 	};
-	using Enum = std::map<std::wstring, std::wstring>;
 	using Type = std::variant<arger::Primitive, arger::Enum>;
 
 	using Checker = std::function<std::wstring(const arger::Parsed&)>;
 
+	/* dense id of an option within a compiled configuration, which allows the parsed
+	*	results to be queried without looking up the option name again for every access
+	*	(resolved via arger::CompiledConfig::id or arger::Parsed::id, and invalid for unknown names) */
+	struct OptionId {
+		size_t index = size_t(-1);
+
+	public:
+		constexpr bool valid() const {
+			return (index != size_t(-1));
+		}
+	};
+
 	/* exception thrown when a malformed argument-configuration is used */
 	struct ConfigException : public str::BuildException {
 		template <class... Args>
@@ -57,6 +57,26 @@ namespace arger {
 			bool flagHelp = false;
 			bool flagVersion = false;
 		};
+		/* type-erased assignment of the values of an option/positional to a member of a user-defined structure (accepts is invoked with a
+		*	null-type for flags, and convert is only invoked with at least one value and returns the non-throwing assignment of the converted values) */
+		struct Binding {
+			const std::type_info* owner = 0;
+			std::function<std::function<void(void*)>(std::span<arger::Value>, const std::wstring&)> convert;
+			bool(*accepts)(const arger::Type*) = 0;
+			bool multiple = false;
+		};
+		struct Bindable {
+			detail::Binding binding;
+		};
+		struct Packable {
+			bool packed = false;
+		};
+		struct LazyConvertible {
+			bool lazyConvert = false;
+		};
+		struct Listable {
+			wchar_t separator = 0;
+		};
 		struct Positionals {
 		public:
 			struct Entry {
@@ -64,6 +84,7 @@ namespace arger {
 				std::wstring name;
 				arger::Type type;
 				std::wstring description;
+				detail::Binding binding;
 			};
 
 		public:
@@ -79,18 +100,102 @@ namespace arger {
 			} groups;
 		};
 
-		template <class Base, class Config>
-		constexpr void ApplyConfigs(Base& base, const Config& config) {
-			config.apply(base);
+		/* forward the configs to ensure temporary configs are moved into place instead of being copied */
+		template <class Base, class... Configs>
+		constexpr void ApplyConfigs(Base& base, Configs&&... configs) {
+			(std::forward<Configs>(configs).apply(base), ...);
+		}
+
+		/* supported members are strings, arithmetic types, and optionals or vectors of them (vectors receive all values) */
+		template <class Type>
+		struct BindMember {
+			using Element = Type;
+			static constexpr bool multiple = false;
+		};
+		template <class Type>
+		struct BindMember<std::optional<Type>> {
+			using Element = Type;
+			static constexpr bool multiple = false;
+		};
+		template <class Type>
+		struct BindMember<std::vector<Type>> {
+			using Element = Type;
+			static constexpr bool multiple = true;
+		};
+		template <class Type>
+		concept IsBindable = std::is_arithmetic_v<typename detail::BindMember<Type>::Element> || std::is_same_v<typename detail::BindMember<Type>::Element, std::wstring>;
+
+		template <class Type>
+		constexpr bool BindAccepts(const arger::Type* type) {
+			/* flags can only be bound to booleans, and enums are bound to strings */
+			if (type == 0)
+				return std::is_same_v<Type, bool>;
+			if (std::holds_alternative<arger::Enum>(*type))
+				return std::is_same_v<Type, std::wstring>;
+
+			switch (std::get<arger::Primitive>(*type)) {
+			case arger::Primitive::boolean:
+				return std::is_same_v<Type, bool>;
+			case arger::Primitive::real:
+				return std::is_floating_point_v<Type>;
+			case arger::Primitive::inum:
+				return (std::is_floating_point_v<Type> || (std::is_integral_v<Type> && std::is_signed_v<Type>));
+			case arger::Primitive::unum:
+				return (std::is_arithmetic_v<Type> && !std::is_same_v<Type, bool>);
+			case arger::Primitive::any:
+			default:
+				return std::is_same_v<Type, std::wstring>;
+			}
+		}
+		template <class Type>
+		inline Type BindConvert(arger::Value&& value, const std::wstring& name) {
+			if constexpr (std::is_same_v<Type, std::wstring>)
+				return std::move(value).str();
+			else if constexpr (std::is_same_v<Type, bool>)
+				return value.boolean();
+			else if constexpr (std::is_floating_point_v<Type>)
+				return Type(value.real());
+
+			/* check if the integer fits into the member */
+			else if constexpr (std::is_unsigned_v<Type>) {
+				if (value.unum() > std::numeric_limits<Type>::max())
+					throw arger::ParsingException{ L"Value of argument [", name, L"] is out of range." };
+				return Type(value.unum());
+			}
+			else {
+				if (value.isUNum() ? (value.unum() > uint64_t(std::numeric_limits<Type>::max())) : (value.inum() < int64_t(std::numeric_limits<Type>::min())))
+					throw arger::ParsingException{ L"Value of argument [", name, L"] is out of range." };
+				return Type(value.inum());
+			}
 		}
-		template <class Base, class Config, class... Configs>
-		constexpr void ApplyConfigs(Base& base, const Config& config, const Configs&... configs) {
-			config.apply(base);
-			ApplyConfigs<Base, Configs...>(base, configs...);
+		template <class Owner, class Member>
+		inline detail::Binding MakeBinding(Member Owner::* member) {
+			using Element = typename detail::BindMember<Member>::Element;
+
+			detail::Binding binding;
+			binding.owner = &typeid(Owner);
+			binding.accepts = &detail::BindAccepts<Element>;
+			binding.multiple = detail::BindMember<Member>::multiple;
+			binding.convert = [member](std::span<arger::Value> values, const std::wstring& name) -> std::function<void(void*)> {
+				/* convert all values into a temporary first, which is only moved into the member once all bindings have been converted */
+				Member out{};
+				if constexpr (detail::BindMember<Member>::multiple) {
+					for (auto& value : values)
+						out.push_back(detail::BindConvert<Element>(std::move(value), name));
+				}
+				else
+					out = detail::BindConvert<Element>(std::move(values.back()), name);
+				return [member, out = std::move(out)](void* target) mutable {
+					static_cast<Owner*>(target)->*member = std::move(out);
+				};
+			};
+			return binding;
 		}
 
 		struct Arguments :
 			public detail::Require,
+			public detail::Packable,
+			public detail::LazyConvertible,
 			public detail::Positionals,
 			public detail::Constraint,
 			public detail::Groups {
@@ -98,8 +203,8 @@ namespace arger {
 	}
 
 	template <class Type, class Base>
-	concept IsConfig = std::is_base_of_v<detail::Config, Type>&& requires(const Type t, Base b) {
-		t.apply(b);
+	concept IsConfig = std::is_base_of_v<detail::Config, std::remove_cvref_t<Type>>&& requires(Type&& t, Base b) {
+		std::forward<Type>(t).apply(b);
 	};
 
 	/* general arger-configuration to be parsed */
@@ -112,7 +217,7 @@ namespace arger {
 		public detail::Program {
 	public:
 		constexpr Config();
-		constexpr Config(const arger::IsConfig<arger::Config> auto&... configs);
+		constexpr Config(arger::IsConfig<arger::Config> auto&&... configs);
 	};
 
 	/* general sub-group of options for a configuration/group
@@ -130,10 +235,13 @@ namespace arger {
 
 	public:
 		Group(std::wstring name, std::wstring id);
-		constexpr Group(std::wstring name, std::wstring id, const arger::IsConfig<arger::Group> auto&... configs);
-		constexpr void apply(detail::Groups& base) const {
+		constexpr Group(std::wstring name, std::wstring id, arger::IsConfig<arger::Group> auto&&... configs);
+		constexpr void apply(detail::Groups& base) const& {
 			base.groups.list.push_back(*this);
 		}
+		constexpr void apply(detail::Groups& base) && {
+			base.groups.list.push_back(std::move(*this));
+		}
 	};
 
 	/* general optional flag/payload */
@@ -144,31 +252,38 @@ namespace arger {
 		public detail::Require,
 		public detail::Abbreviation,
 		public detail::Payload,
+		public detail::Bindable,
+		public detail::Packable,
+		public detail::LazyConvertible,
+		public detail::Listable,
 		public detail::SpecialPurpose {
 	public:
 		std::wstring name;
 
 	public:
 		Option(std::wstring name);
-		constexpr Option(std::wstring name, const arger::IsConfig<arger::Option> auto&... configs);
-		constexpr void apply(detail::Options& base) const {
+		constexpr Option(std::wstring name, arger::IsConfig<arger::Option> auto&&... configs);
+		constexpr void apply(detail::Options& base) const& {
 			base.options.push_back(*this);
 		}
+		constexpr void apply(detail::Options& base) && {
+			base.options.push_back(std::move(*this));
+		}
 	};
 
 	constexpr arger::Config::Config() {}
-	constexpr arger::Config::Config(const arger::IsConfig<arger::Config> auto&... configs) {
-		detail::ApplyConfigs(*this, configs...);
+	constexpr arger::Config::Config(arger::IsConfig<arger::Config> auto&&... configs) {
+		detail::ApplyConfigs(*this, std::forward<decltype(configs)>(configs)...);
 	}
 
-	arger::Group::Group(std::wstring name, std::wstring id) : name{ name }, id{ id } {}
-	constexpr arger::Group::Group(std::wstring name, std::wstring id, const arger::IsConfig<arger::Group> auto&... configs) : name{ name }, id{ id } {
-		detail::ApplyConfigs(*this, configs...);
+	arger::Group::Group(std::wstring name, std::wstring id) : name{ std::move(name) }, id{ std::move(id) } {}
+	constexpr arger::Group::Group(std::wstring name, std::wstring id, arger::IsConfig<arger::Group> auto&&... configs) : name{ std::move(name) }, id{ std::move(id) } {
+		detail::ApplyConfigs(*this, std::forward<decltype(configs)>(configs)...);
 	}
 
-	arger::Option::Option(std::wstring name) : name{ name } {}
-	constexpr arger::Option::Option(std::wstring name, const arger::IsConfig<arger::Option> auto&... configs) : name{ name } {
-		detail::ApplyConfigs(*this, configs...);
+	arger::Option::Option(std::wstring name) : name{ std::move(name) } {}
+	constexpr arger::Option::Option(std::wstring name, arger::IsConfig<arger::Option> auto&&... configs) : name{ std::move(name) } {
+		detail::ApplyConfigs(*this, std::forward<decltype(configs)>(configs)...);
 	}
 
 	/* version for the current configuration */
@@ -177,10 +292,13 @@ namespace arger {
 		std::wstring version;
 
 	public:
-		constexpr Version(std::wstring version) : version{ version } {}
-		constexpr void apply(detail::Version& base) const {
+		constexpr Version(std::wstring version) : version{ std::move(version) } {}
+		constexpr void apply(detail::Version& base) const& {
 			base.version = version;
 		}
+		constexpr void apply(detail::Version& base) && {
+			base.version = std::move(version);
+		}
 	};
 
 	/* default alternative program name for the configuration */
@@ -189,10 +307,13 @@ namespace arger {
 		std::wstring program;
 
 	public:
-		constexpr Program(std::wstring program) : program{ program } {}
-		constexpr void apply(detail::Program& base) const {
+		constexpr Program(std::wstring program) : program{ std::move(program) } {}
+		constexpr void apply(detail::Program& base) const& {
 			base.program = program;
 		}
+		constexpr void apply(detail::Program& base) && {
+			base.program = std::move(program);
+		}
 	};
 
 	/* description to the corresponding object */
@@ -201,10 +322,13 @@ namespace arger {
 		std::wstring desc;
 
 	public:
-		constexpr Description(std::wstring desc) : desc{ desc } {}
-		constexpr void apply(detail::Description& base) const {
+		constexpr Description(std::wstring desc) : desc{ std::move(desc) } {}
+		constexpr void apply(detail::Description& base) const& {
 			base.description = desc;
 		}
+		constexpr void apply(detail::Description& base) && {
+			base.description = std::move(desc);
+		}
 	};
 
 	/* add help-string to the corresponding object */
@@ -213,10 +337,13 @@ namespace arger {
 		detail::Help::Entry entry;
 
 	public:
-		constexpr Help(std::wstring name, std::wstring text) : entry{ name, text } {}
-		constexpr void apply(detail::Help& base) const {
+		constexpr Help(std::wstring name, std::wstring text) : entry{ std::move(name), std::move(text) } {}
+		constexpr void apply(detail::Help& base) const& {
 			base.help.push_back(entry);
 		}
+		constexpr void apply(detail::Help& base) && {
+			base.help.push_back(std::move(entry));
+		}
 	};
 
 	/* add a constraint to be executed if the corresponding object is selected via the arguments */
@@ -225,14 +352,18 @@ namespace arger {
 		arger::Checker constraint;
 
 	public:
-		Constraint(arger::Checker constraint) : constraint{ constraint } {}
-		constexpr void apply(detail::Constraint& base) const {
+		Constraint(arger::Checker constraint) : constraint{ std::move(constraint) } {}
+		constexpr void apply(detail::Constraint& base) const& {
 			base.constraints.push_back(constraint);
 		}
+		constexpr void apply(detail::Constraint& base) && {
+			base.constraints.push_back(std::move(constraint));
+		}
 	};
 
 	/* add a minimum/maximum requirement [maximum=0 implies no maximum]
 	*	- [Option]: are only acknowledged for non-flags with a default of [min: 0, max: 1]
+	*	- [List-Option]: constrains the number of values of all lists of the option with a default of [min: 0, max: unlimited]
 	*	- [Otherwise]: constrains the number of positional arguments with a default of [min = max = number-of-positionals];
 	*		if greater than number of positional arguments, last type is used as catch-all */
 	struct Require : public detail::Config {
@@ -269,13 +400,18 @@ namespace arger {
 		arger::Type type;
 
 	public:
-		Payload(std::wstring name, arger::Type type, std::vector<arger::Value> defValue = {}) : defValue{ defValue }, name{ name }, type{ type } {}
-		Payload(std::wstring name, arger::Type type, arger::Value defValue) : defValue{ defValue }, name{ name }, type{ type } {}
-		constexpr void apply(detail::Payload& base) const {
+		Payload(std::wstring name, arger::Type type, std::vector<arger::Value> defValue = {}) : defValue{ std::move(defValue) }, name{ std::move(name) }, type{ std::move(type) } {}
+		Payload(std::wstring name, arger::Type type, arger::Value defValue) : defValue{ std::move(defValue) }, name{ std::move(name) }, type{ std::move(type) } {}
+		constexpr void apply(detail::Payload& base) const& {
 			base.payload.defValue = defValue;
 			base.payload.name = name;
 			base.payload.type = type;
 		}
+		constexpr void apply(detail::Payload& base) && {
+			base.payload.defValue = std::move(defValue);
+			base.payload.name = std::move(name);
+			base.payload.type = std::move(type);
+		}
 	};
 
 	/* add usage-constraints to let the corresponding options only be used by groups, which add them as usage (by default every group/argument can use all options) */
@@ -285,9 +421,15 @@ namespace arger {
 
 	public:
 		Use(const auto&... options) : options{ options... } {}
-		void apply(detail::Use& base) const {
+		void apply(detail::Use& base) const& {
 			base.use.insert(options.begin(), options.end());
 		}
+		void apply(detail::Use& base) && {
+			if (base.use.empty())
+				base.use = std::move(options);
+			else
+				base.use.merge(options);
+		}
 	};
 
 	/* mark this flag/group as being the help-indicating flag, which triggers the help-menu to be printed (prior to verifying the remainder of the argument structure) */
@@ -314,10 +456,71 @@ namespace arger {
 		std::wstring name;
 
 	public:
-		constexpr GroupName(std::wstring name) : name{ name } {}
-		constexpr void apply(detail::Groups& base) const {
+		constexpr GroupName(std::wstring name) : name{ std::move(name) } {}
+		constexpr void apply(detail::Groups& base) const& {
 			base.groups.name = name;
 		}
+		constexpr void apply(detail::Groups& base) && {
+			base.groups.name = std::move(name);
+		}
+	};
+
+	/* store the numeric values of the option/catch-all positional of the configuration/group contiguously in their native type,
+	*	instead of as separate arger::Value's (must be of type unum, inum, or real, and is accessed via arger::Parsed::unums etc.) */
+	struct Packed : public detail::Config {
+	public:
+		constexpr Packed() {}
+		constexpr void apply(detail::Packable& base) const {
+			base.packed = true;
+		}
+	};
+
+	/* only convert the numeric values of the option/positionals of the configuration/group, when they are first accessed (the
+	*	limits are still checked upfront, but invalid values only throw arger::ParsingException, once they are accessed)
+	*	Note: Has no effect on packed or non-numeric values */
+	struct LazyConvert : public detail::Config {
+	public:
+		constexpr LazyConvert() {}
+		constexpr void apply(detail::LazyConvertible& base) const {
+			base.lazyConvert = true;
+		}
+	};
+
+	/* split every payload of the option at the ascii separator into separate values (such as --ids=1,2,3), for which the requirement-counts
+	*	limit the number of values instead of the number of occurrences (combined with arger::Packed, the values are converted into their
+	*	native type in bulk and stored contiguously, without creating an arger::Value per element)
+	*	Note: Empty values, such as trailing separators or empty payloads, are rejected */
+	struct List : public detail::Config {
+	public:
+		wchar_t separator = 0;
+
+	public:
+		constexpr List(wchar_t separator = L',') : separator{ separator } {}
+		constexpr void apply(detail::Listable& base) const {
+			base.separator = separator;
+		}
+	};
+
+	/* bind the option/positional to a member of a user-defined structure, into which copies of the converted values are written,
+	*	when the arguments are parsed into an object of the structure (the values remain stored in arger::Parsed as well)
+	*	- members can be strings, arithmetic types, or optionals of them, and vectors, if multiple values can be given
+	*	- flags can be bound to booleans, and enums to strings
+	*	- default values are written into the member as well, and untouched members retain their previous value
+	*	- members are only written once all constraints have been satisfied (which see bound values like any other value), and all bound
+	*		values have been converted, and are otherwise left untouched */
+	struct Bind : public detail::Config {
+	public:
+		detail::Binding binding;
+
+	public:
+		template <class Owner, detail::IsBindable Member>
+		Bind(Member Owner::* member) : binding{ detail::MakeBinding(member) } {}
+		void apply(detail::Bindable& base) const& {
+			base.binding = binding;
+		}
+		void apply(detail::Bindable& base) && {
+			base.binding = std::move(binding);
+		}
 	};
 
 	/* add an additional positional argument to the configuration/group using the given name, type, description, and optional default value (must meet the requirement-counts)
@@ -328,10 +531,15 @@ namespace arger {
 		detail::Positionals::Entry entry;
 
 	public:
-		Positional(std::wstring name, arger::Type type, std::wstring description) : entry{ std::nullopt, name, type, description } {}
-		Positional(std::wstring name, arger::Type type, std::wstring description, arger::Value defValue) : entry{ defValue, name, type, description } {}
-		constexpr void apply(detail::Positionals& base) const {
+		Positional(std::wstring name, arger::Type type, std::wstring description) : entry{ std::nullopt, std::move(name), std::move(type), std::move(description), {} } {}
+		Positional(std::wstring name, arger::Type type, std::wstring description, arger::Value defValue) : entry{ std::move(defValue), std::move(name), std::move(type), std::move(description), {} } {}
+		Positional(std::wstring name, arger::Type type, std::wstring description, arger::Bind bind) : entry{ std::nullopt, std::move(name), std::move(type), std::move(description), std::move(bind.binding) } {}
+		Positional(std::wstring name, arger::Type type, std::wstring description, arger::Value defValue, arger::Bind bind) : entry{ std::move(defValue), std::move(name), std::move(type), std::move(description), std::move(bind.binding) } {}
+		constexpr void apply(detail::Positionals& base) const& {
 			base.positionals.push_back(entry);
 		}
+		constexpr void apply(detail::Positionals& base) && {
+			base.positionals.push_back(std::move(entry));
+		}
 	};
 }
@@ -0,0 +1,403 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2024 Bjoern Boss Henrichsen */
+#pragma once
+
+#include "arger-common.h"
+
+namespace arger {
+	namespace detail {
+		static constexpr size_t NoName = size_t(-1);
+
+		/* collision-free hash-table over a fixed set of unique names (hash and displace), which
+		*	resolves every name with a single hash and a single verifying comparison (falls back to
+		*	a linear search, if the names cannot be placed, which only happens for colliding full hashes) */
+		class NameTable {
+		private:
+			static constexpr size_t MaxDisplacements = 0x100000;
+			static constexpr size_t MaxGrowths = 4;
+
+		private:
+			std::vector<uint32_t> pDisplace;
+			std::vector<std::pair<std::wstring_view, size_t>> pSlots;
+
+		private:
+			template <class ChType>
+			static constexpr uint64_t fHash(const std::basic_string_view<ChType>& name) {
+				uint64_t hash = 0xcbf29ce484222325;
+				for (ChType c : name)
+					hash = (hash ^ uint64_t(std::make_unsigned_t<ChType>(c))) * 0x00000100000001b3;
+				return hash;
+			}
+			template <class ChType>
+			static constexpr bool fEqual(const std::wstring_view& slot, const std::basic_string_view<ChType>& name) {
+				if constexpr (std::is_same_v<ChType, wchar_t>)
+					return (slot == name);
+				else {
+					if (slot.size() != name.size())
+						return false;
+					for (size_t i = 0; i < name.size(); ++i) {
+						if (slot[i] != wchar_t(name[i]))
+							return false;
+					}
+					return true;
+				}
+			}
+			template <class ChType>
+			constexpr size_t fFind(const std::basic_string_view<ChType>& name) const {
+				if (pSlots.empty())
+					return detail::NoName;
+
+				/* check if the names are searched linearly, as no collision-free placement exists */
+				if (pDisplace.empty()) {
+					for (const auto& slot : pSlots) {
+						if (fEqual(slot.first, name))
+							return slot.second;
+					}
+					return detail::NoName;
+				}
+
+				uint64_t hash = fHash(name);
+				const auto& slot = pSlots[size_t(fMix(hash, pDisplace[hash & (pDisplace.size() - 1)]) & (pSlots.size() - 1))];
+				return (fEqual(slot.first, name) ? slot.second : detail::NoName);
+			}
+			void fLinear(const std::vector<std::wstring_view>& names) {
+				pDisplace.clear();
+				pSlots.clear();
+				for (size_t i = 0; i < names.size(); ++i)
+					pSlots.emplace_back(names[i], i);
+			}
+			static constexpr uint64_t fMix(uint64_t hash, uint32_t displace) {
+				hash += (uint64_t(displace) + 1) * 0x9e3779b97f4a7c15;
+				hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+				hash = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+				return (hash ^ (hash >> 31));
+			}
+			bool fPlace(const std::vector<std::wstring_view>& names, const std::vector<uint64_t>& hashes, size_t buckets, size_t slots) {
+				pDisplace.assign(buckets, 0);
+				pSlots.assign(slots, { std::wstring_view{}, detail::NoName });
+
+				/* collect the names per bucket and place the largest buckets first */
+				std::vector<std::vector<size_t>> collected(buckets);
+				for (size_t i = 0; i < names.size(); ++i)
+					collected[hashes[i] & (buckets - 1)].push_back(i);
+				std::vector<size_t> order(buckets);
+				for (size_t i = 0; i < buckets; ++i)
+					order[i] = i;
+				std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return collected[a].size() > collected[b].size(); });
+
+				/* find a displacement for every bucket, which maps all of its names to free and distinct slots */
+				std::vector<size_t> taken;
+				for (size_t bucket : order) {
+					if (collected[bucket].empty())
+						break;
+
+					uint32_t displace = 0;
+					for (; displace < detail::NameTable::MaxDisplacements; ++displace) {
+						taken.clear();
+						for (size_t name : collected[bucket]) {
+							size_t slot = size_t(fMix(hashes[name], displace) & (slots - 1));
+							if (pSlots[slot].second != detail::NoName || std::find(taken.begin(), taken.end(), slot) != taken.end())
+								break;
+							taken.push_back(slot);
+						}
+						if (taken.size() == collected[bucket].size())
+							break;
+					}
+					if (displace >= detail::NameTable::MaxDisplacements)
+						return false;
+
+					pDisplace[bucket] = displace;
+					for (size_t i = 0; i < taken.size(); ++i)
+						pSlots[taken[i]] = { names[collected[bucket][i]], collected[bucket][i] };
+				}
+				return true;
+			}
+
+		public:
+			/* setup the table for the given unique names (the names must outlive the table) */
+			void build(const std::vector<std::wstring_view>& names) {
+				pDisplace.clear();
+				pSlots.clear();
+				if (names.empty())
+					return;
+
+				std::vector<uint64_t> hashes(names.size());
+				for (size_t i = 0; i < names.size(); ++i)
+					hashes[i] = fHash(names[i]);
+
+				/* check if two names share the same full hash, in which case no displacement can ever separate them */
+				std::vector<uint64_t> sorted = hashes;
+				std::sort(sorted.begin(), sorted.end());
+				if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+					fLinear(names);
+					return;
+				}
+
+				/* keep the load-factor of the slots below 3/4 and try larger tables, in the unlikely case of no displacement being found */
+				size_t buckets = std::bit_ceil((names.size() + 1) / 2);
+				size_t slots = std::bit_ceil(names.size());
+				if (names.size() * 4 > slots * 3)
+					slots *= 2;
+				for (size_t i = 0; !fPlace(names, hashes, buckets, slots); ++i) {
+					if (i >= detail::NameTable::MaxGrowths) {
+						fLinear(names);
+						return;
+					}
+					slots *= 2;
+				}
+			}
+			constexpr size_t find(const std::wstring_view& name) const {
+				return fFind(name);
+			}
+
+			/* resolve a name of another encoding, which must only consist of ascii characters (its code-units
+			*	are therefore equal to the wide characters of the names and can be hashed and compared directly) */
+			template <class ChType>
+			constexpr size_t findAscii(const std::basic_string_view<ChType>& name) const {
+				return fFind(name);
+			}
+		};
+
+		/* compiled lookup of the values of an enum, which resolves every value to its index within the sorted values
+		*	(small enums are searched directly, larger enums are resolved via a name table, and the names are
+		*	only referenced within the values of the enum, which must therefore outlive the table) */
+		class EnumTable {
+		private:
+			static constexpr size_t MaxSearched = 8;
+
+		private:
+			std::vector<const std::wstring*> pNames;
+			detail::NameTable pTable;
+
+		public:
+			void build(const std::map<std::wstring, std::wstring>& values) {
+				pNames.clear();
+				pNames.reserve(values.size());
+				for (const auto& [name, _] : values)
+					pNames.push_back(&name);
+				if (pNames.size() <= detail::EnumTable::MaxSearched)
+					return;
+
+				std::vector<std::wstring_view> names;
+				names.reserve(pNames.size());
+				for (const std::wstring* name : pNames)
+					names.push_back(*name);
+				pTable.build(names);
+			}
+			constexpr size_t find(const std::wstring_view& name) const {
+				if (pNames.size() > detail::EnumTable::MaxSearched)
+					return pTable.find(name);
+				auto it = std::lower_bound(pNames.begin(), pNames.end(), name, [](const std::wstring* entry, const std::wstring_view& name) { return *entry < name; });
+				return ((it != pNames.end() && **it == name) ? size_t(it - pNames.begin()) : detail::NoName);
+			}
+			constexpr const std::wstring* name(size_t index) const {
+				return pNames[index];
+			}
+		};
+
+		/* matched enum value, which only references the name within its shared enum (see arger::Value::enumIndex) */
+		struct EnumRef {
+			std::shared_ptr<const std::wstring> name;
+			size_t index = 0;
+		};
+	}
+
+	/* external source of the values of an enum, which is only queried, when given values of the enum are looked up
+	*	(for very large sets of values, which should neither be constructed on startup nor be listed by the help-menu) */
+	class EnumProvider {
+	public:
+		virtual ~EnumProvider() = default;
+
+	public:
+		/* index of the name within the values (or detail::NoName, if the name is not a value of the enum) */
+		virtual size_t find(const std::wstring_view& name) const = 0;
+
+		/* summary of the values, which is printed by the help-menu instead of the values themselves */
+		virtual std::wstring summary() const = 0;
+
+		/* current values and their descriptions, which are listed by the help-menu instead of the summary (null to print the summary) */
+		virtual std::shared_ptr<const std::map<std::wstring, std::wstring>> list() const {
+			return 0;
+		}
+	};
+
+	/* enum provider over newline-separated UTF-8 names, which are sorted by their bytes (for example a memory-mapped file)
+	*	- names are looked up via binary search within the data, without the data being parsed or copied upfront
+	*	- the index of a value is the offset of its line within the data
+	*	Note: The data must outlive the provider and all enums using it */
+	class SortedEnum : public arger::EnumProvider {
+	private:
+		std::string_view pData;
+		std::wstring pSummary;
+
+	public:
+		SortedEnum(std::string_view data, std::wstring summary) : pData{ data }, pSummary{ std::move(summary) } {}
+
+	public:
+		size_t find(const std::wstring_view& name) const override {
+			std::u8string encoded = str::u8::To(name);
+			std::string_view key{ reinterpret_cast<const char*>(encoded.data()), encoded.size() };
+
+			/* the search range always starts and ends at the beginning of a line */
+			size_t low = 0, high = pData.size();
+			while (low < high) {
+				size_t middle = low + (high - low) / 2;
+				size_t begin = (middle == 0 ? std::string_view::npos : pData.rfind('\n', middle - 1));
+				begin = ((begin == std::string_view::npos || begin < low) ? low : begin + 1);
+				size_t end = std::min(pData.find('\n', begin), pData.size());
+
+				/* compare the line (excluding carriage-returns of windows line-endings) */
+				std::string_view line = pData.substr(begin, end - begin);
+				if (!line.empty() && line.back() == '\r')
+					line.remove_suffix(1);
+				int result = line.compare(key);
+				if (result == 0)
+					return begin;
+				if (result < 0)
+					low = std::min(end + 1, high);
+				else
+					high = begin;
+			}
+			return detail::NoName;
+		}
+		std::wstring summary() const override {
+			return pSummary;
+		}
+	};
+
+	/* enum provider over values, which are only known at runtime and supplied by a callback, and which are cached as snapshot
+	*	- the snapshot is refetched on the next lookup, once it has been invalidated (which increments the generation),
+	*		or once it is older than the time-to-live (if the time-to-live is not zero)
+	*	- lookups and the help-menu use the cached snapshot, and only the enum itself is refreshed (without the configuration
+	*		having to be recompiled)
+	*	- the index of a value is its index within the sorted values of the snapshot, it was matched in */
+	class DynamicEnum : public arger::EnumProvider {
+	public:
+		using Fetch = std::function<std::map<std::wstring, std::wstring>()>;
+
+	private:
+		struct Snapshot {
+			std::map<std::wstring, std::wstring> values;
+			detail::EnumTable table;
+			uint64_t generation = 0;
+			std::chrono::steady_clock::time_point fetched;
+		};
+
+	private:
+		Fetch pFetch;
+		std::wstring pSummary;
+		std::chrono::steady_clock::duration pTimeToLive{};
+		mutable std::shared_ptr<const Snapshot> pSnapshot;
+		mutable std::mutex pMutex;
+		std::atomic<uint64_t> pGeneration = 0;
+
+	public:
+		DynamicEnum(Fetch fetch, std::wstring summary, std::chrono::steady_clock::duration timeToLive = {}) : pFetch{ std::move(fetch) }, pSummary{ std::move(summary) }, pTimeToLive{ timeToLive } {}
+
+	private:
+		std::shared_ptr<const Snapshot> fCurrent() const {
+			std::lock_guard<std::mutex> _lock{ pMutex };
+			uint64_t generation = pGeneration.load();
+			std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+			/* check if the cached snapshot can still be used */
+			if (pSnapshot != 0 && pSnapshot->generation == generation && (pTimeToLive.count() == 0 || now - pSnapshot->fetched < pTimeToLive))
+				return pSnapshot;
+
+			/* fetch the current values and compile their lookup-table */
+			std::shared_ptr<Snapshot> snapshot = std::make_shared<Snapshot>(Snapshot{ pFetch(), {}, generation, now });
+			snapshot->table.build(snapshot->values);
+			pSnapshot = snapshot;
+			return pSnapshot;
+		}
+
+	public:
+		/* mark the cached values as outdated, which causes them to be refetched on the next lookup */
+		void invalidate() {
+			++pGeneration;
+		}
+		uint64_t generation() const {
+			return pGeneration.load();
+		}
+
+	public:
+		size_t find(const std::wstring_view& name) const override {
+			return fCurrent()->table.find(name);
+		}
+		std::wstring summary() const override {
+			return pSummary;
+		}
+		std::shared_ptr<const std::map<std::wstring, std::wstring>> list() const override {
+			std::shared_ptr<const Snapshot> snapshot = fCurrent();
+			return std::shared_ptr<const std::map<std::wstring, std::wstring>>{ snapshot, &snapshot->values };
+		}
+	};
+
+	/* immutable set of enum values and their descriptions, which is reference-counted and therefore shared by all options,
+	*	positionals, and configurations it is copied into (the lookup-table of the values is compiled once on construction)
+	*	Note: Enums backed by a provider contain no values, and their default values are neither validated nor resolved to their index */
+	class Enum {
+		template <class ChType>
+		friend class detail::Parser;
+	public:
+		using Values = std::map<std::wstring, std::wstring>;
+
+	private:
+		struct Shared {
+			Values values;
+			detail::EnumTable table;
+			std::shared_ptr<const arger::EnumProvider> provider;
+		};
+
+	private:
+		std::shared_ptr<const Shared> pShared;
+
+	public:
+		Enum() : Enum{ Values{} } {}
+		Enum(std::initializer_list<Values::value_type> values) : Enum{ Values{ values } } {}
+		Enum(Values values) {
+			std::shared_ptr<Shared> shared = std::make_shared<Shared>(Shared{ std::move(values), {}, 0 });
+			shared->table.build(shared->values);
+			pShared = std::move(shared);
+		}
+		Enum(std::shared_ptr<const arger::EnumProvider> provider) : pShared{ std::make_shared<const Shared>(Shared{ {}, {}, std::move(provider) }) } {}
+
+	private:
+		detail::EnumRef fRef(size_t index, const std::wstring_view& name) const {
+			/* values of providers are not stored within the enum, and therefore need to keep their own name */
+			if (pShared->provider != 0)
+				return detail::EnumRef{ std::make_shared<const std::wstring>(name), index };
+			return detail::EnumRef{ std::shared_ptr<const std::wstring>{ pShared, pShared->table.name(index) }, index };
+		}
+
+	public:
+		Values::const_iterator begin() const {
+			return pShared->values.begin();
+		}
+		Values::const_iterator end() const {
+			return pShared->values.end();
+		}
+		size_t size() const {
+			return pShared->values.size();
+		}
+		bool empty() const {
+			return (pShared->values.empty() && pShared->provider == 0);
+		}
+		const Values& values() const {
+			return pShared->values;
+		}
+		const arger::EnumProvider* provider() const {
+			return pShared->provider.get();
+		}
+
+		/* index of the name within the sorted values or the provider (or detail::NoName, if the name is not a value of the enum) */
+		size_t index(const std::wstring_view& name) const {
+			if (pShared->provider != 0)
+				return pShared->provider->find(name);
+			return pShared->table.find(name);
+		}
+		size_t count(const std::wstring_view& name) const {
+			return (index(name) == detail::NoName ? 0 : 1);
+		}
+	};
+}
@@ -0,0 +1,354 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2024 Bjoern Boss Henrichsen */
+#pragma once
+
+#include "arger-common.h"
+#include "arger-config.h"
+#include "arger-verify.h"
+#include "arger-static.h"
+
+#include <cstdio>
+#include <cmath>
+
+namespace arger {
+	namespace detail {
+		class Generator {
+		private:
+			std::string pTables;
+			std::set<std::string> pAccessors;
+			size_t pNextTable = 0;
+
+		private:
+			std::string fLiteral(const std::wstring_view& str) const {
+				static constexpr const char* HexDigits = "0123456789abcdef";
+				std::string out = "L\"";
+
+				for (size_t i = 0; i < str.size(); ++i) {
+					wchar_t c = str[i];
+					if (c == L'\"' || c == L'\\')
+						out.append({ '\\', char(c) });
+					else if (c == L'\n')
+						out.append("\\n");
+					else if (c == L'\t')
+						out.append("\\t");
+					else if (c >= 0x20 && c < 0x7f)
+						out.push_back(char(c));
+
+					/* write the remaining control characters as fixed-length octal escape-sequences */
+					else if (c >= 0 && c < 0xa0) {
+						out.push_back('\\');
+						for (int j = 2; j >= 0; --j)
+							out.push_back(HexDigits[(uint32_t(c) >> (j * 3)) & 0x07]);
+					}
+
+					/* write all other characters as universal character names of their codepoint, which are independent of the size of wchar_t
+					*	on the generating and the compiling platform (surrogate-pairs of 16-bit wchar_t are combined into their codepoint) */
+					else {
+						uint32_t cp = uint32_t(c);
+						if (sizeof(wchar_t) == 2 && cp >= 0xd800 && cp < 0xdc00 && i + 1 < str.size() && uint32_t(str[i + 1]) >= 0xdc00 && uint32_t(str[i + 1]) < 0xe000)
+							cp = 0x10000 + ((cp - 0xd800) << 10) + (uint32_t(str[++i]) - 0xdc00);
+						if ((cp >= 0xd800 && cp < 0xe000) || cp > 0x10ffff)
+							throw arger::ConfigException{ L"String [", str, L"] contains an invalid codepoint and cannot be generated into static tables." };
+						out.append(cp > 0xffff ? "\\U" : "\\u");
+						for (int j = (cp > 0xffff ? 7 : 3); j >= 0; --j)
+							out.push_back(HexDigits[(cp >> (j * 4)) & 0x0f]);
+					}
+				}
+				return out.append("\"");
+			}
+			std::string fCharacter(wchar_t c) const {
+				if (c == L'\'' || c == L'\\')
+					return std::string("L'\\") + char(c) + "'";
+				if (c >= 0x20 && c < 0x7f)
+					return std::string("L'") + char(c) + "'";
+				return "wchar_t(" + std::to_string(uint32_t(c)) + ")";
+			}
+			std::string fValue(const arger::Value& value) const {
+				if (value.isStr())
+					return "arger::StaticValue{ " + fLiteral(value.str()) + " }";
+				if (value.isUNum())
+					return "arger::StaticValue{ uint64_t(" + std::to_string(value.unum()) + "u) }";
+				if (value.isINum()) {
+					if (value.inum() == std::numeric_limits<int64_t>::min())
+						return "arger::StaticValue{ std::numeric_limits<int64_t>::min() }";
+					return "arger::StaticValue{ int64_t(" + std::to_string(value.inum()) + ") }";
+				}
+				if (value.isReal()) {
+					/* write the real out as hex-float to ensure it is reproduced exactly */
+					double real = value.real();
+					if (std::isnan(real))
+						return "arger::StaticValue{ std::numeric_limits<double>::quiet_NaN() }";
+					if (std::isinf(real))
+						return std::string("arger::StaticValue{ ") + (real < 0 ? "-" : "") + "std::numeric_limits<double>::infinity() }";
+					char buffer[64] = { 0 };
+					std::snprintf(buffer, sizeof(buffer), "%a", real);
+					return std::string("arger::StaticValue{ ") + buffer + " }";
+				}
+				return (value.boolean() ? "arger::StaticValue{ true }" : "arger::StaticValue{ false }");
+			}
+			std::string fPrimitive(arger::Primitive primitive) const {
+				switch (primitive) {
+				case arger::Primitive::inum:
+					return "arger::Primitive::inum";
+				case arger::Primitive::unum:
+					return "arger::Primitive::unum";
+				case arger::Primitive::real:
+					return "arger::Primitive::real";
+				case arger::Primitive::boolean:
+					return "arger::Primitive::boolean";
+				case arger::Primitive::any:
+				default:
+					return "arger::Primitive::any";
+				}
+			}
+			std::string fTable(const std::string& type, const std::string& prefix, const std::vector<std::string>& entries) {
+				std::string name = prefix + std::to_string(pNextTable++);
+				pTables.append("\t\tinline constexpr " + type + " " + name + "[] = {\n");
+				for (size_t i = 0; i < entries.size(); ++i)
+					pTables.append("\t\t\t" + entries[i] + (i + 1 < entries.size() ? ",\n" : "\n"));
+				pTables.append("\t\t};\n");
+				return "detail::" + name;
+			}
+			std::string fType(const arger::Type& type) {
+				if (std::holds_alternative<arger::Primitive>(type))
+					return fPrimitive(std::get<arger::Primitive>(type));
+
+				if (std::get<arger::Enum>(type).provider() != 0)
+					throw arger::ConfigException{ L"Externally backed enums cannot be generated into static tables." };
+				std::vector<std::string> entries;
+				for (const auto& [name, description] : std::get<arger::Enum>(type))
+					entries.push_back("{ " + fLiteral(name) + ", " + fLiteral(description) + " }");
+				return fTable("arger::StaticEnum", "enum", entries);
+			}
+			void fHelp(std::string& out, const detail::Help& help) {
+				if (help.help.empty())
+					return;
+				std::vector<std::string> entries;
+				for (const auto& entry : help.help)
+					entries.push_back("{ " + fLiteral(entry.name) + ", " + fLiteral(entry.text) + " }");
+				out.append(", .help = " + fTable("arger::StaticHelp", "help", entries));
+			}
+			void fArguments(std::string& out, const detail::Arguments& arguments) {
+				if (arguments.packed)
+					throw arger::ConfigException{ L"Packed arguments cannot be generated into static tables." };
+				if (arguments.lazyConvert)
+					throw arger::ConfigException{ L"Lazily converted arguments cannot be generated into static tables." };
+
+				/* write the sub-groups out first, as they must be declared before being referenced */
+				if (!arguments.groups.list.empty()) {
+					std::vector<std::string> entries;
+					for (const auto& group : arguments.groups.list)
+						entries.push_back(fGroup(group));
+					out.append(", .groups = " + fTable("arger::StaticGroup", "groups", entries));
+				}
+				if (!arguments.groups.name.empty())
+					out.append(", .groupName = " + fLiteral(arguments.groups.name));
+
+				/* write the positionals out */
+				if (!arguments.positionals.empty()) {
+					std::vector<std::string> entries;
+					for (const auto& positional : arguments.positionals) {
+						std::string entry = "{ " + fLiteral(positional.name) + ", " + fType(positional.type) + ", " + fLiteral(positional.description);
+						if (positional.defValue.has_value())
+							entry.append(", " + fValue(*positional.defValue));
+						entries.push_back(entry + " }");
+					}
+					out.append(", .positionals = " + fTable("arger::StaticPositional", "positionals", entries));
+				}
+
+				/* write the limits out */
+				if (arguments.require.minimum.has_value())
+					out.append(", .minimum = " + std::to_string(*arguments.require.minimum));
+				if (arguments.require.maximum.has_value())
+					out.append(", .maximum = " + std::to_string(*arguments.require.maximum));
+			}
+			std::string fGroup(const arger::Group& group) {
+				std::string out = "{ .name = " + fLiteral(group.name);
+				if (!group.id.empty())
+					out.append(", .id = " + fLiteral(group.id));
+				if (!group.description.empty())
+					out.append(", .description = " + fLiteral(group.description));
+				fArguments(out, group);
+
+				/* write the usages out */
+				if (!group.use.empty()) {
+					std::vector<std::string> entries;
+					for (const auto& use : group.use)
+						entries.push_back("std::wstring_view{ " + fLiteral(use) + " }");
+					out.append(", .use = " + fTable("std::wstring_view", "use", entries));
+				}
+				fHelp(out, group);
+				if (group.flagHelp)
+					out.append(", .flagHelp = true");
+				if (group.flagVersion)
+					out.append(", .flagVersion = true");
+				return out + " }";
+			}
+			std::string fOption(const arger::Option& option) {
+				if (option.packed)
+					throw arger::ConfigException{ L"Packed option [", option.name, L"] cannot be generated into static tables." };
+				if (option.lazyConvert)
+					throw arger::ConfigException{ L"Lazily converted option [", option.name, L"] cannot be generated into static tables." };
+				if (option.separator != 0)
+					throw arger::ConfigException{ L"List option [", option.name, L"] cannot be generated into static tables." };
+				std::string out = "{ .name = " + fLiteral(option.name);
+				if (!option.description.empty())
+					out.append(", .description = " + fLiteral(option.description));
+				if (option.abbreviation != 0)
+					out.append(", .abbreviation = " + fCharacter(option.abbreviation));
+
+				/* write the payload out */
+				if (!option.payload.name.empty()) {
+					out.append(", .payload = " + fLiteral(option.payload.name) + ", .type = " + fType(option.payload.type));
+					if (!option.payload.defValue.empty()) {
+						std::vector<std::string> entries;
+						for (const auto& value : option.payload.defValue)
+							entries.push_back(fValue(value));
+						out.append(", .defValue = " + fTable("arger::StaticValue", "values", entries));
+					}
+				}
+
+				/* write the limits and flags out */
+				if (option.require.minimum.has_value())
+					out.append(", .minimum = " + std::to_string(*option.require.minimum));
+				if (option.require.maximum.has_value())
+					out.append(", .maximum = " + std::to_string(*option.require.maximum));
+				if (option.flagHelp)
+					out.append(", .flagHelp = true");
+				if (option.flagVersion)
+					out.append(", .flagVersion = true");
+				return out + " }";
+			}
+			std::string fIdentifier(const std::wstring& name) {
+				std::string out;
+
+				/* convert the name to pascal-case and drop all characters, which cannot be used within an identifier */
+				bool upper = true;
+				for (wchar_t c : name) {
+					if (!(c >= L'a' && c <= L'z') && !(c >= L'A' && c <= L'Z') && !(c >= L'0' && c <= L'9')) {
+						upper = true;
+						continue;
+					}
+					out.push_back((upper && c >= L'a' && c <= L'z') ? char(c - L'a' + L'A') : char(c));
+					upper = false;
+				}
+				if (out.empty() || (out[0] >= '0' && out[0] <= '9'))
+					out.insert(0, "Option");
+
+				/* ensure the identifier is unique, as different names might result in the same identifier */
+				std::string unique = out;
+				for (size_t i = 2; pAccessors.contains(unique); ++i)
+					unique = out + std::to_string(i);
+				pAccessors.insert(unique);
+				return unique;
+			}
+			std::string fComment(const std::wstring& name) const {
+				std::string out;
+				for (wchar_t c : name)
+					out.push_back((c >= 0x20 && c < 0x7f && c != L'*') ? char(c) : '?');
+				return out;
+			}
+			std::string fId(const arger::Option& option, const std::string& name, const std::string& space) const {
+				/* resolve the dense id at compile-time from the static configuration itself, which ensures it matches the compiled configuration */
+				return "\t\tinline constexpr arger::OptionId " + name + "{ arger::detail::StaticOptionId(" + space + "::Config, arger::detail::StaticFindOption(" + space + "::Config, " + fLiteral(option.name) + ")) };\n";
+			}
+			std::string fAccessor(const arger::Option& option, const std::string& name, const std::string& space) const {
+				/* flags are accessed as boolean */
+				if (option.payload.name.empty())
+					return "\t\t/* flag [--" + fComment(option.name) + "] */\n"
+					"\t\tinline bool " + name + "(const " + space + "::Parsed& parsed) {\n"
+					"\t\t\treturn parsed.parsed().flag(ids::" + name + ");\n"
+					"\t\t}\n";
+
+				/* fetch the type and accessor of the payload */
+				std::string type = "std::wstring", access = "str()";
+				if (std::holds_alternative<arger::Primitive>(option.payload.type)) {
+					switch (std::get<arger::Primitive>(option.payload.type)) {
+					case arger::Primitive::inum:
+						type = "int64_t";
+						access = "inum()";
+						break;
+					case arger::Primitive::unum:
+						type = "uint64_t";
+						access = "unum()";
+						break;
+					case arger::Primitive::real:
+						type = "double";
+						access = "real()";
+						break;
+					case arger::Primitive::boolean:
+						type = "bool";
+						access = "boolean()";
+						break;
+					case arger::Primitive::any:
+						break;
+					}
+				}
+
+				/* payloads are accessed as list of all values */
+				return "\t\t/* payload [--" + fComment(option.name) + "] */\n"
+					"\t\tinline std::vector<" + type + "> " + name + "(const " + space + "::Parsed& parsed) {\n"
+					"\t\t\tstd::vector<" + type + "> out;\n"
+					"\t\t\tfor (const arger::Value& value : parsed.parsed().optionValues(ids::" + name + "))\n"
+					"\t\t\t\tout.push_back(value." + access + ");\n"
+					"\t\t\treturn out;\n"
+					"\t\t}\n";
+			}
+
+		public:
+			std::string generate(const arger::Config& config, bool menu, const std::string& space) {
+				/* write all tables out (sub-tables are written before their referencing tables) */
+				std::string root;
+				if (!config.program.empty())
+					root.append(", .program = " + fLiteral(config.program));
+				if (!config.version.empty())
+					root.append(", .version = " + fLiteral(config.version));
+				if (!config.description.empty())
+					root.append(", .description = " + fLiteral(config.description));
+				if (!config.options.empty()) {
+					std::vector<std::string> entries;
+					for (const auto& option : config.options)
+						entries.push_back(fOption(option));
+					root.append(", .options = " + fTable("arger::StaticOption", "options", entries));
+				}
+				fArguments(root, config);
+				fHelp(root, config);
+				root = (root.empty() ? "{}" : "{ " + root.substr(2) + " }");
+
+				/* write the ids and accessors out */
+				std::string ids, accessors;
+				for (const auto& option : config.options) {
+					std::string name = fIdentifier(option.name);
+					ids.append(fId(option, name, space));
+					accessors.append(fAccessor(option, name, space));
+				}
+
+				/* construct the final header */
+				std::string out = "/* generated by arger::Generate - do not edit */\n"
+					"#pragma once\n\n"
+					"#include <arger/arger.h>\n\n"
+					"namespace " + space + " {\n";
+				if (!pTables.empty())
+					out.append("\tnamespace detail {\n" + pTables + "\t}\n\n");
+				out.append("\t/* static configuration (constraints must be added to the built configuration) */\n"
+					"\tinline constexpr arger::StaticConfig Config" + root + ";\n"
+					"\tstatic_assert(arger::StaticValidate(" + space + "::Config, " + (menu ? "true" : "false") + "));\n\n"
+					"\t/* compiled configuration (not validated again at runtime) and the parsed results, which are accessed by the accessors */\n"
+					"\tusing Compiled = arger::StaticCompiled<" + space + "::Config, " + (menu ? "true" : "false") + ">;\n"
+					"\tusing Parsed = arger::StaticParsed<" + space + "::Config>;\n");
+				if (!accessors.empty()) {
+					out.append("\n\t/* dense ids of the options */\n\tnamespace ids {\n" + ids + "\t}\n");
+					out.append("\n\t/* typed accessors of the options */\n\tnamespace options {\n" + accessors + "\t}\n");
+				}
+				return out.append("}\n");
+			}
+		};
+	}
+
+	/* generate the source of a C++ header, which contains the validated configuration as static tables within the given namespace
+	*	(to be compiled via the declared Compiled type), the dense ids of all options, and typed accessors for every option, which
+	*	access the values by their id through the declared Parsed type (constraints cannot be expressed statically) */
+	inline std::string Generate(const arger::CompiledConfig& config, const std::string& space) {
+		return detail::Generator{}.generate(config.config(), config.menu(), space);
+	}
+}
@@ -166,8 +166,17 @@ namespace arger {
 				if (!std::holds_alternative<arger::Enum>(type))
 					return;
 
+				/* add the summary of externally backed enums instead of their values (unless they list their current values) */
+				const arger::EnumProvider* provider = std::get<arger::Enum>(type).provider();
+				std::shared_ptr<const std::map<std::wstring, std::wstring>> values = (provider == 0 ? 0 : provider->list());
+				if (provider != 0 && values == 0) {
+					fAddNewLine(false);
+					fAddString(str::wd::Build(L"- ", provider->summary()), detail::NumCharsHelpLeft);
+					return;
+				}
+
 				/* add the separate keys */
-				for (const auto& val : std::get<arger::Enum>(type)) {
+				for (const auto& val : (values == 0 ? std::get<arger::Enum>(type).values() : *values)) {
 					fAddNewLine(false);
 					fAddString(str::wd::Build(L"- [", val.first, L"]: ", val.second), detail::NumCharsHelpLeft);
 				}
@@ -262,15 +271,15 @@ namespace arger {
 
 				/* add all required options (must all consume a payload, as flags are never required) */
 				bool hasOptionals = false;
-				for (const auto& [name, option] : pConfig.options) {
+				for (const auto& option : pConfig.options) {
 					/* check if the entry can be skipped for this group */
-					if (option.restricted && !option.users.contains(pSelected))
+					if (option.restricted && !option.users[topMost->index])
 						continue;
 					if (option.minimum == 0) {
 						hasOptionals = true;
 						continue;
 					}
-					fAddSpacedToken(str::wd::Build(L"--", name, L"=<", option.option->payload.name, L">"));
+					fAddSpacedToken(str::wd::Build(L"--", option.option->name, L"=<", option.option->payload.name, L">"));
 				}
 				if (hasOptionals)
 					fAddSpacedToken(L"[options...]");
@@ -296,12 +305,12 @@ namespace arger {
 				const detail::ValidArguments* topMost = (pSelected == 0 ? static_cast<const detail::ValidArguments*>(&pConfig) : pSelected);
 
 				/* iterate over the optionals and add the corresponding type */
-				for (const auto& [name, option] : pConfig.options) {
+				for (const auto& option : pConfig.options) {
 					if ((option.minimum > 0) != required)
 						continue;
 
 					/* check if the argument is excluded by the current selected group, based on the usage-requirements */
-					if (option.restricted && !option.users.contains(pSelected))
+					if (option.restricted && !option.users[topMost->index])
 						continue;
 					fAddNewLine(false);
 
@@ -309,20 +318,24 @@ namespace arger {
 					std::wstring temp = L"  ";
 					if (option.option->abbreviation != 0)
 						temp.append(1, L'-').append(1, option.option->abbreviation).append(L", ");
-					temp.append(L"--").append(name);
-					if (option.payload)
-						temp.append(L"=<").append(option.option->payload.name).append(1, L'>').append(fTypeString(option.option->payload.type));
+					temp.append(L"--").append(option.option->name);
+					if (option.payload) {
+						temp.append(L"=<").append(option.option->payload.name).append(1, L'>');
+						if (option.option->separator != 0)
+							temp.append(L"[").append(1, option.option->separator).append(L"...]");
+						temp.append(fTypeString(option.option->payload.type));
+					}
 					fAddString(temp);
 
 					/* construct the description text (add the users, if the optional argument is not a
 					*	general purpose argument, and there are still groups available to be selected) */
 					temp = option.option->description;
-					if (option.restricted && option.users.contains(pSelected) && topMost->incomplete) {
+					if (option.restricted && option.users[topMost->index] && topMost->incomplete) {
 						temp += L" (Used for: ";
 						size_t index = 0;
 						for (const auto& group : topMost->sub) {
-							if (option.users.contains(&group.second))
-								temp.append(index++ > 0 ? L"|" : L"").append(group.first);
+							if (option.users[group.index])
+								temp.append(index++ > 0 ? L"|" : L"").append(group.group->name);
 						}
 						temp.append(1, L')');
 					}
@@ -360,9 +373,9 @@ namespace arger {
 				if (topMost->incomplete) {
 					fAddNewLine(true);
 					fAddString(str::wd::Build(L"Options for [", topMost->groupName, L"]:"));
-					for (const auto& [name, group] : topMost->sub) {
+					for (const auto& group : topMost->sub) {
 						fAddNewLine(false);
-						fAddString(str::wd::Build(L"  ", name));
+						fAddString(str::wd::Build(L"  ", group.group->name));
 						fAddString(group.group->description, detail::NumCharsHelpLeft, 1);
 					}
 				}
@@ -398,9 +411,9 @@ namespace arger {
 
 				/* check if there are optional/required arguments */
 				bool optArgs = false, reqArgs = false;
-				for (const auto& entry : pConfig.options) {
-					if (!entry.second.restricted || entry.second.users.contains(pSelected))
-						(entry.second.minimum > 0 ? reqArgs : optArgs) = true;
+				for (const auto& option : pConfig.options) {
+					if (!option.restricted || option.users[topMost->index])
+						(option.minimum > 0 ? reqArgs : optArgs) = true;
 				}
 
 				/* add the required argument descriptions (will automatically be sorted lexicographically) */
@@ -433,4 +446,7 @@ namespace arger {
 	inline constexpr std::wstring HelpHint(const std::vector<std::wstring>& args, const arger::Config& config) {
 		return detail::BaseBuilder{ (args.empty() ? L"" : args[0]), config, false }.buildHelpHintString();
 	}
+	inline constexpr std::wstring HelpHint(const std::vector<std::wstring>& args, const arger::CompiledConfig& config) {
+		return arger::HelpHint(args, config.config());
+	}
 }
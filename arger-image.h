@@ -0,0 +1,445 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2024 Bjoern Boss Henrichsen */
+#pragma once
+
+#include "arger-common.h"
+#include "arger-config.h"
+#include "arger-verify.h"
+
+#include <cstring>
+
+namespace arger {
+	/* constraints to be re-attached to a loaded image (keyed by option name and group name/id) */
+	struct ImageConstraints {
+		std::vector<arger::Checker> config;
+		std::map<std::wstring, std::vector<arger::Checker>> options;
+		std::map<std::wstring, std::vector<arger::Checker>> groups;
+	};
+
+	namespace detail {
+		/* binary image layout: all records consist of 32-bit words and only reference each other by indices, and strings
+		*	are referenced by offset and length into a trailing string-pool, which makes the image position-independent
+		*	- header: [magic, version, sizeof(wchar_t), menu, checksum, (offset, count) per table, root-config, pool-offset, pool-length]
+		*	- tables: options, groups (sub-groups adjacent to each other), positionals, enum-entries, values, help, usages
+		*	- checksum: FNV-1a over all bytes following the checksum itself */
+		static constexpr uint32_t ImageMagic = 0x49475241;
+		static constexpr uint32_t ImageVersion = 2;
+		static constexpr uint32_t ImageNoIndex = uint32_t(-1);
+		enum class ImageTable : uint8_t {
+			options,
+			groups,
+			positionals,
+			enums,
+			values,
+			help,
+			uses,
+			_count
+		};
+		static constexpr size_t ImageRecordSize[size_t(detail::ImageTable::_count)] = { 17, 21, 8, 4, 3, 4, 2 };
+		static constexpr size_t ImageArgumentsSize = 10;
+		static constexpr size_t ImageRootSize = 8 + detail::ImageArgumentsSize;
+		static constexpr size_t ImageChecksumWord = 4;
+		static constexpr size_t ImageHeaderSize = detail::ImageChecksumWord + 1 + 2 * size_t(detail::ImageTable::_count) + detail::ImageRootSize + 2;
+
+		inline uint32_t ImageChecksum(std::span<const uint8_t> data) {
+			uint32_t hash = 0x811c9dc5;
+			for (uint8_t byte : data)
+				hash = (hash ^ byte) * 0x01000193;
+			return hash;
+		}
+
+		class ImageWriter {
+		private:
+			std::vector<uint32_t> pTables[size_t(detail::ImageTable::_count)];
+			std::wstring pPool;
+
+		private:
+			void fString(std::vector<uint32_t>& out, const std::wstring& str) {
+				out.push_back(uint32_t(pPool.size()));
+				out.push_back(uint32_t(str.size()));
+				pPool.append(str);
+			}
+			void fOptional(std::vector<uint32_t>& out, const std::optional<size_t>& value) {
+				out.push_back(value.has_value() ? 1 : 0);
+				out.push_back(uint32_t(value.value_or(0)));
+			}
+			uint32_t fValue(const arger::Value& value) {
+				std::vector<uint32_t>& out = pTables[size_t(detail::ImageTable::values)];
+				uint32_t index = uint32_t(out.size() / detail::ImageRecordSize[size_t(detail::ImageTable::values)]);
+				uint64_t bits = 0;
+
+				/* write the kind of the value and its bits (strings are written to the pool) */
+				if (value.isStr()) {
+					out.push_back(4);
+					fString(out, value.str());
+					return index;
+				}
+				if (value.isUNum()) {
+					out.push_back(0);
+					bits = value.unum();
+				}
+				else if (value.isINum()) {
+					out.push_back(1);
+					bits = uint64_t(value.inum());
+				}
+				else if (value.isReal()) {
+					out.push_back(2);
+					double real = value.real();
+					std::memcpy(&bits, &real, sizeof(bits));
+				}
+				else {
+					out.push_back(3);
+					bits = (value.boolean() ? 1 : 0);
+				}
+				out.push_back(uint32_t(bits));
+				out.push_back(uint32_t(bits >> 32));
+				return index;
+			}
+			void fType(std::vector<uint32_t>& out, const arger::Type& type) {
+				std::vector<uint32_t>& enums = pTables[size_t(detail::ImageTable::enums)];
+				if (!std::holds_alternative<arger::Enum>(type)) {
+					out.insert(out.end(), { uint32_t(std::get<arger::Primitive>(type)), 0, 0 });
+					return;
+				}
+
+				/* write the enum entries out */
+				const arger::Enum& values = std::get<arger::Enum>(type);
+				if (values.provider() != 0)
+					throw arger::ConfigException{ L"Externally backed enums cannot be saved into an image." };
+				out.insert(out.end(), { uint32_t(arger::Primitive::any), uint32_t(enums.size() / detail::ImageRecordSize[size_t(detail::ImageTable::enums)]), uint32_t(values.size()) });
+				for (const auto& [name, description] : values) {
+					fString(enums, name);
+					fString(enums, description);
+				}
+			}
+			void fHelp(std::vector<uint32_t>& out, const detail::Help& help) {
+				std::vector<uint32_t>& table = pTables[size_t(detail::ImageTable::help)];
+				out.push_back(uint32_t(table.size() / detail::ImageRecordSize[size_t(detail::ImageTable::help)]));
+				out.push_back(uint32_t(help.help.size()));
+				for (const auto& entry : help.help) {
+					fString(table, entry.name);
+					fString(table, entry.text);
+				}
+			}
+			void fArguments(std::vector<uint32_t>& out, const detail::Arguments& arguments, uint32_t groupFirst) {
+				std::vector<uint32_t>& table = pTables[size_t(detail::ImageTable::positionals)];
+				if (arguments.packed)
+					throw arger::ConfigException{ L"Packed arguments cannot be saved into an image." };
+				if (arguments.lazyConvert)
+					throw arger::ConfigException{ L"Lazily converted arguments cannot be saved into an image." };
+				fString(out, arguments.groups.name);
+				fOptional(out, arguments.require.minimum);
+				fOptional(out, arguments.require.maximum);
+
+				/* write the positionals out */
+				out.push_back(uint32_t(table.size() / detail::ImageRecordSize[size_t(detail::ImageTable::positionals)]));
+				out.push_back(uint32_t(arguments.positionals.size()));
+				for (const auto& positional : arguments.positionals) {
+					fString(table, positional.name);
+					fString(table, positional.description);
+					fType(table, positional.type);
+					table.push_back(positional.defValue.has_value() ? fValue(*positional.defValue) : detail::ImageNoIndex);
+				}
+
+				/* write the range of the sub-groups */
+				out.push_back(groupFirst);
+				out.push_back(uint32_t(arguments.groups.list.size()));
+			}
+
+		public:
+			std::vector<uint8_t> write(const arger::Config& config, bool menu) {
+				std::vector<uint32_t> root;
+
+				/* write the options out */
+				std::vector<uint32_t>& options = pTables[size_t(detail::ImageTable::options)];
+				for (const auto& option : config.options) {
+					if (option.packed)
+						throw arger::ConfigException{ L"Packed option [", option.name, L"] cannot be saved into an image." };
+					if (option.lazyConvert)
+						throw arger::ConfigException{ L"Lazily converted option [", option.name, L"] cannot be saved into an image." };
+					if (option.separator != 0)
+						throw arger::ConfigException{ L"List option [", option.name, L"] cannot be saved into an image." };
+					fString(options, option.name);
+					fString(options, option.description);
+					options.push_back(uint32_t(option.abbreviation));
+					options.push_back((option.flagHelp ? 0x01 : 0x00) | (option.flagVersion ? 0x02 : 0x00));
+					fOptional(options, option.require.minimum);
+					fOptional(options, option.require.maximum);
+					fString(options, option.payload.name);
+					fType(options, option.payload.type);
+					options.push_back(uint32_t(pTables[size_t(detail::ImageTable::values)].size() / detail::ImageRecordSize[size_t(detail::ImageTable::values)]));
+					options.push_back(uint32_t(option.payload.defValue.size()));
+					for (const auto& value : option.payload.defValue)
+						fValue(value);
+				}
+
+				/* write the root configuration out (sub-groups of every level are written adjacent to each other, in breadth-first order) */
+				std::vector<const detail::Arguments*> queue;
+				uint32_t nextGroup = uint32_t(config.groups.list.size());
+				fString(root, config.program);
+				fString(root, config.version);
+				fString(root, config.description);
+				fHelp(root, config);
+				fArguments(root, config, 0);
+				queue.push_back(&config);
+
+				/* write all groups out */
+				std::vector<uint32_t>& groups = pTables[size_t(detail::ImageTable::groups)];
+				std::vector<uint32_t>& uses = pTables[size_t(detail::ImageTable::uses)];
+				for (size_t i = 0; i < queue.size(); ++i) {
+					for (const auto& group : queue[i]->groups.list) {
+						fString(groups, group.name);
+						fString(groups, group.id);
+						fString(groups, group.description);
+						groups.push_back((group.flagHelp ? 0x01 : 0x00) | (group.flagVersion ? 0x02 : 0x00));
+						groups.push_back(uint32_t(uses.size() / detail::ImageRecordSize[size_t(detail::ImageTable::uses)]));
+						groups.push_back(uint32_t(group.use.size()));
+						for (const auto& use : group.use)
+							fString(uses, use);
+						fHelp(groups, group);
+						fArguments(groups, group, nextGroup);
+						nextGroup += uint32_t(group.groups.list.size());
+						queue.push_back(&group);
+					}
+				}
+
+				/* construct the header and the table offsets */
+				std::vector<uint32_t> words = { detail::ImageMagic, detail::ImageVersion, uint32_t(sizeof(wchar_t)), (menu ? 1u : 0u), 0 };
+				size_t offset = detail::ImageHeaderSize;
+				for (size_t i = 0; i < size_t(detail::ImageTable::_count); ++i) {
+					words.push_back(uint32_t(offset));
+					words.push_back(uint32_t(pTables[i].size() / detail::ImageRecordSize[i]));
+					offset += pTables[i].size();
+				}
+				words.insert(words.end(), root.begin(), root.end());
+				words.push_back(uint32_t(offset));
+				words.push_back(uint32_t(pPool.size()));
+				for (size_t i = 0; i < size_t(detail::ImageTable::_count); ++i)
+					words.insert(words.end(), pTables[i].begin(), pTables[i].end());
+
+				/* serialize the words and the string-pool */
+				std::vector<uint8_t> out(words.size() * sizeof(uint32_t) + pPool.size() * sizeof(wchar_t));
+				std::memcpy(out.data(), words.data(), words.size() * sizeof(uint32_t));
+				std::memcpy(out.data() + words.size() * sizeof(uint32_t), pPool.data(), pPool.size() * sizeof(wchar_t));
+
+				/* seal the image by its checksum */
+				uint32_t checksum = detail::ImageChecksum(std::span<const uint8_t>{ out }.subspan((detail::ImageChecksumWord + 1) * sizeof(uint32_t)));
+				std::memcpy(out.data() + detail::ImageChecksumWord * sizeof(uint32_t), &checksum, sizeof(uint32_t));
+				return out;
+			}
+		};
+
+		class ImageReader {
+		private:
+			std::span<const uint8_t> pImage;
+			const arger::ImageConstraints& pConstraints;
+			size_t pTables[size_t(detail::ImageTable::_count)] = { 0 };
+			size_t pCounts[size_t(detail::ImageTable::_count)] = { 0 };
+			size_t pPool = 0;
+			size_t pPoolLength = 0;
+			std::vector<bool> pVisited[size_t(detail::ImageTable::_count)];
+
+		public:
+			ImageReader(std::span<const uint8_t> image, const arger::ImageConstraints& constraints) : pImage{ image }, pConstraints{ constraints } {}
+
+		private:
+			uint32_t fWord(size_t index) const {
+				uint32_t out = 0;
+				if ((index + 1) * sizeof(uint32_t) > pImage.size())
+					throw arger::ConfigException{ L"Image is truncated." };
+				std::memcpy(&out, pImage.data() + index * sizeof(uint32_t), sizeof(uint32_t));
+				return out;
+			}
+			size_t fRecord(detail::ImageTable table, size_t index) {
+				if (index >= pCounts[size_t(table)])
+					throw arger::ConfigException{ L"Image references an invalid record." };
+
+				/* every record is referenced exactly once by a valid image, which caps the total number of visited records and ensures
+				*	that records shared between multiple references cannot result in an exponential amount of work */
+				if (pVisited[size_t(table)][index])
+					throw arger::ConfigException{ L"Image references records multiple times." };
+				pVisited[size_t(table)][index] = true;
+				return pTables[size_t(table)] + index * detail::ImageRecordSize[size_t(table)];
+			}
+			std::wstring fString(size_t word) const {
+				size_t offset = fWord(word), length = fWord(word + 1);
+				if (offset + length > pPoolLength)
+					throw arger::ConfigException{ L"Image references an invalid string." };
+
+				std::wstring out(length, L'\0');
+				std::memcpy(out.data(), pImage.data() + pPool + offset * sizeof(wchar_t), length * sizeof(wchar_t));
+				return out;
+			}
+			std::optional<size_t> fOptional(size_t word) const {
+				if (fWord(word) == 0)
+					return std::nullopt;
+				return fWord(word + 1);
+			}
+			arger::Value fValue(size_t index) {
+				size_t word = fRecord(detail::ImageTable::values, index);
+				uint64_t bits = (uint64_t(fWord(word + 2)) << 32) | fWord(word + 1);
+				switch (fWord(word)) {
+				case 0:
+					return arger::Value{ bits };
+				case 1:
+					return arger::Value{ int64_t(bits) };
+				case 2: {
+					double real = 0;
+					std::memcpy(&real, &bits, sizeof(real));
+					return arger::Value{ real };
+				}
+				case 3:
+					return arger::Value{ bits != 0 };
+				case 4:
+					return arger::Value{ fString(word + 1) };
+				default:
+					throw arger::ConfigException{ L"Image contains an invalid value." };
+				}
+			}
+			arger::Type fType(size_t word) {
+				if (fWord(word + 2) == 0) {
+					if (fWord(word) > uint32_t(arger::Primitive::boolean))
+						throw arger::ConfigException{ L"Image contains an invalid type." };
+					return arger::Primitive(fWord(word));
+				}
+
+				arger::Enum::Values out;
+				for (size_t i = 0; i < fWord(word + 2); ++i) {
+					size_t entry = fRecord(detail::ImageTable::enums, fWord(word + 1) + i);
+					out.insert({ fString(entry), fString(entry + 2) });
+				}
+				return arger::Enum{ std::move(out) };
+			}
+			void fHelp(detail::Help& help, size_t word) {
+				for (size_t i = 0; i < fWord(word + 1); ++i) {
+					size_t entry = fRecord(detail::ImageTable::help, fWord(word) + i);
+					help.help.push_back({ fString(entry), fString(entry + 2) });
+				}
+			}
+			void fConstraints(detail::Constraint& constraint, const std::map<std::wstring, std::vector<arger::Checker>>& map, const std::wstring& key) const {
+				auto it = map.find(key);
+				if (it != map.end())
+					constraint.constraints.insert(constraint.constraints.end(), it->second.begin(), it->second.end());
+			}
+			void fArguments(detail::Arguments& arguments, size_t word) {
+				arguments.groups.name = fString(word);
+				arguments.require.minimum = fOptional(word + 2);
+				arguments.require.maximum = fOptional(word + 4);
+
+				/* read the positionals */
+				for (size_t i = 0; i < fWord(word + 7); ++i) {
+					size_t entry = fRecord(detail::ImageTable::positionals, fWord(word + 6) + i);
+					uint32_t defValue = fWord(entry + 7);
+					arguments.positionals.push_back({ (defValue == detail::ImageNoIndex ? std::nullopt : std::optional<arger::Value>{ fValue(defValue) }), fString(entry), fType(entry + 4), fString(entry + 2), {} });
+				}
+
+				/* read the sub-groups (cyclic images are rejected, as they reference their groups multiple times) */
+				for (size_t i = 0; i < fWord(word + 9); ++i) {
+					size_t entry = fRecord(detail::ImageTable::groups, fWord(word + 8) + i);
+					arger::Group& group = arguments.groups.list.emplace_back(fString(entry), fString(entry + 2));
+					group.description = fString(entry + 4);
+					group.flagHelp = ((fWord(entry + 6) & 0x01) != 0);
+					group.flagVersion = ((fWord(entry + 6) & 0x02) != 0);
+					for (size_t j = 0; j < fWord(entry + 8); ++j)
+						group.use.insert(fString(fRecord(detail::ImageTable::uses, fWord(entry + 7) + j)));
+					fHelp(group, entry + 9);
+					fArguments(group, entry + 11);
+					fConstraints(group, pConstraints.groups, group.id.empty() ? group.name : group.id);
+				}
+			}
+
+		public:
+			arger::Config read() {
+				arger::Config out;
+
+				/* validate the header */
+				if (fWord(0) != detail::ImageMagic)
+					throw arger::ConfigException{ L"Image is not an arger configuration image." };
+				if (fWord(1) != detail::ImageVersion)
+					throw arger::ConfigException{ L"Image version is not supported." };
+				if (fWord(2) != sizeof(wchar_t))
+					throw arger::ConfigException{ L"Image has been created for a different character width." };
+				uint32_t checksum = fWord(detail::ImageChecksumWord);
+				if (checksum != detail::ImageChecksum(pImage.subspan((detail::ImageChecksumWord + 1) * sizeof(uint32_t))))
+					throw arger::ConfigException{ L"Image is corrupted." };
+
+				/* setup the table offsets and the visited records */
+				for (size_t i = 0; i < size_t(detail::ImageTable::_count); ++i) {
+					pTables[i] = fWord(detail::ImageChecksumWord + 1 + 2 * i);
+					pCounts[i] = fWord(detail::ImageChecksumWord + 2 + 2 * i);
+					if (pCounts[i] > 0)
+						fWord(pTables[i] + pCounts[i] * detail::ImageRecordSize[i] - 1);
+					pVisited[i].resize(pCounts[i], false);
+				}
+				size_t root = detail::ImageChecksumWord + 1 + 2 * size_t(detail::ImageTable::_count);
+				pPool = fWord(root + detail::ImageRootSize) * sizeof(uint32_t);
+				pPoolLength = fWord(root + detail::ImageRootSize + 1);
+				if (pPool + pPoolLength * sizeof(wchar_t) > pImage.size())
+					throw arger::ConfigException{ L"Image is truncated." };
+
+				/* read the options */
+				for (size_t i = 0; i < pCounts[size_t(detail::ImageTable::options)]; ++i) {
+					size_t entry = fRecord(detail::ImageTable::options, i);
+					arger::Option& option = out.options.emplace_back(fString(entry));
+					option.description = fString(entry + 2);
+					option.abbreviation = wchar_t(fWord(entry + 4));
+					option.flagHelp = ((fWord(entry + 5) & 0x01) != 0);
+					option.flagVersion = ((fWord(entry + 5) & 0x02) != 0);
+					option.require.minimum = fOptional(entry + 6);
+					option.require.maximum = fOptional(entry + 8);
+					option.payload.name = fString(entry + 10);
+					option.payload.type = fType(entry + 12);
+					for (size_t j = 0; j < fWord(entry + 16); ++j)
+						option.payload.defValue.push_back(fValue(fWord(entry + 15) + j));
+					fConstraints(option, pConstraints.options, option.name);
+				}
+
+				/* read the root configuration */
+				out.program = fString(root);
+				out.version = fString(root + 2);
+				out.description = fString(root + 4);
+				fHelp(out, root + 6);
+				fArguments(out, root + 8);
+				out.constraints.insert(out.constraints.end(), pConstraints.config.begin(), pConstraints.config.end());
+				return out;
+			}
+			bool menu() const {
+				return (fWord(3) != 0);
+			}
+		};
+	}
+
+	/* serialize the validated configuration into a position-independent binary image (constraints are not serialized) */
+	inline std::vector<uint8_t> SaveImage(const arger::CompiledConfig& config) {
+		return detail::ImageWriter{}.write(config.config(), config.menu());
+	}
+
+	/* compiled configuration of a binary image, which owns the decoded configuration, and which has already been validated
+	*	when the image was saved, and is therefore only laid out, without being validated again (constraints are re-attached by key)
+	*	Note: The image is only checked structurally and against its checksum, and must therefore originate from arger::SaveImage
+	*	Note: The records are decoded into a fully allocated configuration (the image is not referenced afterwards)
+	*	Note: Can be passed to the parsing functions via arger::CompiledImage::compiled */
+	class CompiledImage {
+	private:
+		arger::Config pConfig;
+		arger::CompiledConfig pCompiled;
+
+	private:
+		CompiledImage(detail::ImageReader&& reader) : pConfig{ reader.read() }, pCompiled{ pConfig, reader.menu(), false, true } {}
+
+	public:
+		CompiledImage(std::span<const uint8_t> image, const arger::ImageConstraints& constraints = {}) : CompiledImage{ detail::ImageReader{ image, constraints } } {}
+		CompiledImage(arger::CompiledImage&&) = delete;
+		CompiledImage(const arger::CompiledImage&) = delete;
+		arger::CompiledImage& operator=(arger::CompiledImage&&) = delete;
+		arger::CompiledImage& operator=(const arger::CompiledImage&) = delete;
+
+	public:
+		constexpr const arger::CompiledConfig& compiled() const {
+			return pCompiled;
+		}
+		constexpr const arger::Config& config() const {
+			return pConfig;
+		}
+	};
+}
@@ -0,0 +1,524 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2024 Bjoern Boss Henrichsen */
+#pragma once
+
+#include "arger-common.h"
+#include "arger-config.h"
+#include "arger-verify.h"
+
+#include <charconv>
+#include <cctype>
+#include <tuple>
+
+namespace arger {
+	namespace detail {
+		/* single pass json-reader, which constructs the configuration directly from the json document
+		*	(mirrors the fields of the static configuration and decodes every string once directly into its destination) */
+		class JsonReader {
+		private:
+			static constexpr size_t MaxDepth = 64;
+
+		private:
+			std::string_view pSource;
+			std::set<std::wstring> pOptionNames;
+			std::set<wchar_t> pAbbreviations;
+			std::set<std::wstring> pGroupIds;
+			std::vector<std::tuple<std::wstring, std::wstring, size_t>> pUses;
+			size_t pOffset = 0;
+			size_t pDepth = 0;
+			size_t pLocOffset = 0;
+			size_t pLocLine = 1;
+			size_t pLocColumn = 1;
+
+		public:
+			JsonReader(std::string_view source) : pSource{ source } {}
+
+		private:
+			std::wstring fLocation(size_t offset) {
+				/* continue counting from the last location, as the locations are requested in document order
+				*	(only errors might request an earlier location, in which case the counting is restarted) */
+				if (offset < pLocOffset) {
+					pLocOffset = 0;
+					pLocLine = 1;
+					pLocColumn = 1;
+				}
+				for (; pLocOffset < offset && pLocOffset < pSource.size(); ++pLocOffset) {
+					if (pSource[pLocOffset] == '\n') {
+						++pLocLine;
+						pLocColumn = 1;
+					}
+
+					/* only count the first byte of every utf-8 encoded codepoint */
+					else if ((uint8_t(pSource[pLocOffset]) & 0xc0) != 0x80)
+						++pLocColumn;
+				}
+				return str::wd::Build(L"JSON [", pLocLine, L':', pLocColumn, L']');
+			}
+			[[noreturn]] void fError(size_t offset, const std::wstring& message) {
+				throw arger::ConfigException{ L"Error at ", fLocation(offset), L": ", message };
+			}
+			void fSkip() {
+				while (pOffset < pSource.size() && (pSource[pOffset] == ' ' || pSource[pOffset] == '\t' || pSource[pOffset] == '\n' || pSource[pOffset] == '\r'))
+					++pOffset;
+			}
+			char fPeek() {
+				fSkip();
+				if (pOffset >= pSource.size())
+					fError(pOffset, L"Unexpected end of document.");
+				return pSource[pOffset];
+			}
+			void fExpect(char c) {
+				if (fPeek() != c) {
+					wchar_t message[] = L"Expected [ ].";
+					message[10] = wchar_t(c);
+					fError(pOffset, message);
+				}
+				++pOffset;
+			}
+			bool fConsume(char c) {
+				if (fPeek() != c)
+					return false;
+				++pOffset;
+				return true;
+			}
+			void fLiteral(std::string_view literal) {
+				if (pSource.substr(pOffset, literal.size()) != literal)
+					fError(pOffset, L"Invalid literal encountered.");
+				pOffset += literal.size();
+			}
+			void fAppend(std::wstring& out, uint32_t cp) const {
+				if constexpr (sizeof(wchar_t) == 2) {
+					if (cp >= 0x10000) {
+						cp -= 0x10000;
+						out.push_back(wchar_t(0xd800 + (cp >> 10)));
+						out.push_back(wchar_t(0xdc00 + (cp & 0x03ff)));
+						return;
+					}
+				}
+				out.push_back(wchar_t(cp));
+			}
+			uint32_t fHex4() {
+				uint32_t out = 0;
+				if (pOffset + 4 > pSource.size())
+					fError(pOffset, L"Invalid unicode escape sequence.");
+				for (size_t i = 0; i < 4; ++i) {
+					char c = pSource[pOffset++];
+					uint32_t digit = (c >= '0' && c <= '9' ? c - '0' : (c >= 'a' && c <= 'f' ? c - 'a' + 10 : (c >= 'A' && c <= 'F' ? c - 'A' + 10 : 16)));
+					if (digit >= 16)
+						fError(pOffset - 1, L"Invalid unicode escape sequence.");
+					out = (out << 4) | digit;
+				}
+				return out;
+			}
+			uint32_t fEscape() {
+				size_t start = pOffset - 1;
+				if (pOffset >= pSource.size())
+					fError(start, L"Invalid escape sequence.");
+				switch (pSource[pOffset++]) {
+				case '\"':
+					return '\"';
+				case '\\':
+					return '\\';
+				case '/':
+					return '/';
+				case 'b':
+					return '\b';
+				case 'f':
+					return '\f';
+				case 'n':
+					return '\n';
+				case 'r':
+					return '\r';
+				case 't':
+					return '\t';
+				case 'u':
+					break;
+				default:
+					fError(start, L"Invalid escape sequence.");
+				}
+
+				/* decode the utf-16 codepoint (surrogate-pairs must be escaped as pairs) */
+				uint32_t cp = fHex4();
+				if (cp >= 0xdc00 && cp <= 0xdfff)
+					fError(start, L"Invalid unicode escape sequence.");
+				if (cp < 0xd800 || cp > 0xdbff)
+					return cp;
+				if (pSource.substr(pOffset, 2) != "\\u")
+					fError(start, L"Invalid unicode escape sequence.");
+				pOffset += 2;
+				uint32_t low = fHex4();
+				if (low < 0xdc00 || low > 0xdfff)
+					fError(start, L"Invalid unicode escape sequence.");
+				return 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00);
+			}
+			uint32_t fUtf8() {
+				size_t start = pOffset;
+				uint8_t c = uint8_t(pSource[pOffset++]);
+				size_t count = (c >= 0xf0 ? 3 : (c >= 0xe0 ? 2 : 1));
+				uint32_t cp = (c & (0x3f >> count));
+				if (c < 0xc2 || c > 0xf4 || pOffset + count > pSource.size())
+					fError(start, L"Invalid UTF-8 encoding.");
+
+				for (size_t i = 0; i < count; ++i) {
+					uint8_t next = uint8_t(pSource[pOffset++]);
+					if ((next & 0xc0) != 0x80)
+						fError(start, L"Invalid UTF-8 encoding.");
+					cp = (cp << 6) | (next & 0x3f);
+				}
+
+				/* reject overlong encodings, surrogates, and out-of-range codepoints */
+				if ((count == 2 && cp < 0x800) || (count == 3 && cp < 0x10000) || cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff))
+					fError(start, L"Invalid UTF-8 encoding.");
+				return cp;
+			}
+			std::wstring fString() {
+				std::wstring out;
+				fExpect('\"');
+
+				while (true) {
+					/* copy the plain ascii characters in bulk */
+					size_t start = pOffset;
+					while (pOffset < pSource.size() && pSource[pOffset] != '\"' && pSource[pOffset] != '\\' && uint8_t(pSource[pOffset]) >= 0x20 && uint8_t(pSource[pOffset]) < 0x80)
+						++pOffset;
+					out.append(pSource.begin() + start, pSource.begin() + pOffset);
+
+					if (pOffset >= pSource.size())
+						fError(pOffset, L"Unterminated string encountered.");
+					char c = pSource[pOffset];
+					if (c == '\"')
+						break;
+					if (uint8_t(c) < 0x20)
+						fError(pOffset, L"Control characters must be escaped within strings.");
+					if (c == '\\') {
+						++pOffset;
+						fAppend(out, fEscape());
+					}
+					else
+						fAppend(out, fUtf8());
+				}
+				++pOffset;
+				return out;
+			}
+			bool fBool() {
+				char c = fPeek();
+				if (c != 't' && c != 'f')
+					fError(pOffset, L"Expected boolean.");
+				fLiteral(c == 't' ? "true" : "false");
+				return (c == 't');
+			}
+			std::string_view fNumber() {
+				fSkip();
+				size_t start = pOffset;
+				while (pOffset < pSource.size() && (std::isdigit(uint8_t(pSource[pOffset])) || pSource[pOffset] == '-' || pSource[pOffset] == '+' || pSource[pOffset] == '.' || pSource[pOffset] == 'e' || pSource[pOffset] == 'E'))
+					++pOffset;
+				if (start == pOffset)
+					fError(start, L"Expected number.");
+				return pSource.substr(start, pOffset - start);
+			}
+			size_t fSize() {
+				std::string_view number = fNumber();
+				size_t out = 0;
+				auto [end, error] = std::from_chars(number.data(), number.data() + number.size(), out);
+				if (error != std::errc{} || end != number.data() + number.size())
+					fError(pOffset - number.size(), L"Expected unsigned integer.");
+				return out;
+			}
+			arger::Value fValue() {
+				char c = fPeek();
+				if (c == '\"')
+					return arger::Value{ fString() };
+				if (c == 't' || c == 'f')
+					return arger::Value{ fBool() };
+
+				/* parse the number as integer, if it does not contain a fraction or exponent */
+				std::string_view number = fNumber();
+				const char* begin = number.data(), * end = number.data() + number.size();
+				if (number.find_first_of(".eE") == std::string_view::npos) {
+					if (number[0] == '-') {
+						int64_t value = 0;
+						auto [last, error] = std::from_chars(begin, end, value);
+						if (error == std::errc{} && last == end)
+							return arger::Value{ value };
+					}
+					else {
+						uint64_t value = 0;
+						auto [last, error] = std::from_chars(begin, end, value);
+						if (error == std::errc{} && last == end)
+							return arger::Value{ value };
+					}
+				}
+				double value = 0;
+				auto [last, error] = std::from_chars(begin, end, value);
+				if (error != std::errc{} || last != end)
+					fError(pOffset - number.size(), L"Invalid number encountered.");
+				return arger::Value{ value };
+			}
+			template <class Callback>
+			void fArray(Callback callback) {
+				fExpect('[');
+				if (fConsume(']'))
+					return;
+				do {
+					callback();
+				} while (fConsume(','));
+				fExpect(']');
+			}
+			template <class Callback>
+			void fObject(Callback callback) {
+				std::set<std::wstring> keys;
+				fExpect('{');
+				if (fConsume('}'))
+					return;
+
+				do {
+					fPeek();
+					size_t start = pOffset;
+					std::wstring key = fString();
+					if (!keys.insert(key).second)
+						fError(start, L"Duplicate key encountered.");
+					fExpect(':');
+					if (!callback(key))
+						fError(start, L"Unknown key encountered.");
+				} while (fConsume(','));
+				fExpect('}');
+			}
+			arger::Type fType() {
+				/* check if the type is an enum, which is defined by an object of names and descriptions */
+				if (fPeek() == '{') {
+					arger::Enum::Values out;
+					fObject([&](std::wstring& key) -> bool {
+						out.insert({ std::move(key), fString() });
+						return true;
+						});
+					return arger::Enum{ std::move(out) };
+				}
+
+				size_t start = (fPeek(), pOffset);
+				std::wstring name = fString();
+				if (name == L"any")
+					return arger::Primitive::any;
+				if (name == L"inum")
+					return arger::Primitive::inum;
+				if (name == L"unum")
+					return arger::Primitive::unum;
+				if (name == L"real")
+					return arger::Primitive::real;
+				if (name == L"boolean")
+					return arger::Primitive::boolean;
+				fError(start, L"Unknown primitive type encountered.");
+			}
+			void fHelp(detail::Help& help) {
+				fArray([&]() {
+					detail::Help::Entry& entry = help.help.emplace_back();
+					fObject([&](const std::wstring& key) -> bool {
+						if (key == L"name")
+							entry.name = fString();
+						else if (key == L"text")
+							entry.text = fString();
+						else
+							return false;
+						return true;
+						});
+					});
+			}
+			bool fArguments(detail::Arguments& arguments, const std::wstring& key) {
+				if (key == L"groups") {
+					/* names of groups must only be unique within their groups-set, while the ids of groups without
+					*	sub-groups must be globally unique (ids default to the names of the groups) */
+					std::set<std::wstring> names;
+					fArray([&]() {
+						size_t start = (fPeek(), pOffset);
+						const arger::Group& group = fGroup(arguments.groups.list);
+						const std::wstring& id = (group.id.empty() ? group.name : group.id);
+						if (!names.insert(group.name).second)
+							fError(start, str::wd::Build(L"Group with name [", group.name, L"] already exists for given groups-set."));
+						if (group.groups.list.empty() && !pGroupIds.insert(id).second)
+							fError(start, str::wd::Build(L"Group with id [", id, L"] already exists."));
+						});
+				}
+				else if (key == L"groupName")
+					arguments.groups.name = fString();
+				else if (key == L"positionals")
+					fArray([&]() { fPositional(arguments.positionals); });
+				else if (key == L"minimum")
+					arguments.require.minimum = fSize();
+				else if (key == L"maximum")
+					arguments.require.maximum = fSize();
+				else
+					return false;
+				return true;
+			}
+			void fPositional(std::vector<detail::Positionals::Entry>& positionals) {
+				detail::Positionals::Entry& entry = positionals.emplace_back();
+				std::wstring location = (fPeek(), fLocation(pOffset));
+				fObject([&](const std::wstring& key) -> bool {
+					if (key == L"name")
+						entry.name = fString();
+					else if (key == L"type")
+						entry.type = fType();
+					else if (key == L"description")
+						entry.description = fString();
+					else if (key == L"defValue")
+						entry.defValue = fValue();
+					else
+						return false;
+					return true;
+					});
+
+				/* validate the positional in place to allow the errors to reference the document location */
+				std::wstring who = str::wd::Build(L"positional [", entry.name, L"] at ", location);
+				detail::ValidateType(entry.type, who);
+				if (entry.defValue.has_value())
+					detail::ValidateDefValue(entry.type, *entry.defValue, who);
+			}
+			const arger::Group& fGroup(std::vector<arger::Group>& groups) {
+				arger::Group& group = groups.emplace_back(std::wstring{}, std::wstring{});
+				size_t start = (fPeek(), pOffset);
+				std::wstring location = fLocation(start);
+
+				/* limit the nesting of the groups, as they are read recursively */
+				if (++pDepth > detail::JsonReader::MaxDepth)
+					fError(start, L"Groups are nested too deeply.");
+
+				/* collect the usages with their locations, as the options might only be defined afterwards */
+				size_t uses = pUses.size();
+				fObject([&](const std::wstring& key) -> bool {
+					if (key == L"name")
+						group.name = fString();
+					else if (key == L"id")
+						group.id = fString();
+					else if (key == L"description")
+						group.description = fString();
+					else if (key == L"use")
+						fArray([&]() {
+							size_t offset = (fPeek(), pOffset);
+							std::wstring name = fString();
+							pUses.emplace_back(std::wstring{}, name, offset);
+							group.use.insert(std::move(name));
+							});
+					else if (key == L"help")
+						fHelp(group);
+					else if (key == L"flagHelp")
+						group.flagHelp = fBool();
+					else if (key == L"flagVersion")
+						group.flagVersion = fBool();
+					else
+						return fArguments(group, key);
+					return true;
+					});
+				detail::ValidateHelp(group, str::wd::Build(L"group [", group.name, L"] at ", location));
+				--pDepth;
+
+				/* assign the id to the collected usages of this group (usages of sub-groups have already been assigned) */
+				const std::wstring& id = (group.id.empty() ? group.name : group.id);
+				for (size_t i = uses; i < pUses.size(); ++i) {
+					if (std::get<0>(pUses[i]).empty())
+						std::get<0>(pUses[i]) = id;
+				}
+				return group;
+			}
+			void fOption(std::vector<arger::Option>& options) {
+				arger::Option& option = options.emplace_back(std::wstring{});
+				size_t start = (fPeek(), pOffset);
+				std::wstring location = fLocation(start);
+				fObject([&](const std::wstring& key) -> bool {
+					if (key == L"name")
+						option.name = fString();
+					else if (key == L"description")
+						option.description = fString();
+					else if (key == L"abbreviation") {
+						size_t offset = (fPeek(), pOffset);
+						std::wstring abbreviation = fString();
+						if (abbreviation.size() != 1)
+							fError(offset, L"Abbreviation must be a single character.");
+						option.abbreviation = abbreviation[0];
+					}
+					else if (key == L"payload")
+						option.payload.name = fString();
+					else if (key == L"type")
+						option.payload.type = fType();
+					else if (key == L"defValue") {
+						/* default values can either be a single value or an array of values */
+						if (fPeek() == '[')
+							fArray([&]() { option.payload.defValue.push_back(fValue()); });
+						else
+							option.payload.defValue.push_back(fValue());
+					}
+					else if (key == L"minimum")
+						option.require.minimum = fSize();
+					else if (key == L"maximum")
+						option.require.maximum = fSize();
+					else if (key == L"flagHelp")
+						option.flagHelp = fBool();
+					else if (key == L"flagVersion")
+						option.flagVersion = fBool();
+					else
+						return false;
+					return true;
+					});
+
+				/* validate the uniqueness of the name and abbreviation (empty names are rejected when compiling the configuration) */
+				if (!option.name.empty() && !pOptionNames.insert(option.name).second)
+					fError(start, str::wd::Build(L"Option with name [", option.name, L"] already exists."));
+				if (option.abbreviation != 0 && !pAbbreviations.insert(option.abbreviation).second)
+					fError(start, str::wd::Build(L"Option abbreviation [", option.abbreviation, L"] already exists."));
+
+				/* validate the payload in place (remaining checks, which depend on other entries, are performed when compiling the configuration) */
+				if (option.payload.name.empty())
+					return;
+				std::wstring who = str::wd::Build(L"option [", option.name, L"] at ", location);
+				detail::ValidateType(option.payload.type, who);
+				for (const auto& value : option.payload.defValue)
+					detail::ValidateDefValue(option.payload.type, value, who);
+			}
+
+		public:
+			arger::Config read() {
+				arger::Config out;
+
+				/* skip the optional byte-order-mark */
+				if (pSource.starts_with("\xef\xbb\xbf"))
+					pOffset = 3;
+
+				std::wstring location = (fPeek(), fLocation(pOffset));
+				fObject([&](const std::wstring& key) -> bool {
+					if (key == L"program")
+						out.program = fString();
+					else if (key == L"version")
+						out.version = fString();
+					else if (key == L"description")
+						out.description = fString();
+					else if (key == L"options")
+						fArray([&]() { fOption(out.options); });
+					else if (key == L"help")
+						fHelp(out);
+					else
+						return fArguments(out, key);
+					return true;
+					});
+
+				detail::ValidateHelp(out, str::wd::Build(L"configuration at ", location));
+
+				/* validate the usages of all groups, now that all options are known */
+				for (const auto& [id, name, offset] : pUses) {
+					if (!pOptionNames.contains(name))
+						fError(offset, str::wd::Build(L"Group [", id, L"] uses undefined option [", name, L"]."));
+				}
+
+				fSkip();
+				if (pOffset < pSource.size())
+					fError(pOffset, L"Unexpected trailing characters encountered.");
+				return out;
+			}
+		};
+	}
+
+	/* construct the configuration from the utf-8 encoded json document in a single pass (throws arger::ConfigException
+	*	with the line and column for malformed documents, the keys mirror the fields of the static configuration)
+	*	Note: Constraints cannot be expressed in json and must be added to the loaded configuration
+	*	Note: The uniqueness of option names, abbreviations, group names and ids, and the usages of the groups are validated
+	*		with their location as well, while the remaining checks are performed when compiling the loaded configuration */
+	inline arger::Config LoadJson(std::string_view json) {
+		return detail::JsonReader{ json }.read();
+	}
+}
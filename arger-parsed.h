@@ -4,21 +4,82 @@
 
 #include "arger-common.h"
 #include "arger-value.h"
+#include "arger-verify.h"
 
 namespace arger {
-	/* represents the parsed results of the arguments */
+	/* represents the parsed results of the arguments
+	*	- options are indexed by their dense id of the compiled configuration (see arger::OptionId)
+	*	- flags are stored as bitset, and the values of all options are stored contiguously, with
+	*		the values of every option being described by the range [offsets[id], offsets[id + 1])
+	*	- packed options and packed catch-all positionals are stored as ranges within the contiguous
+	*		vectors of their native type, and can only be referenced via the typed spans */
 	class Parsed {
 		friend class arger::Arguments;
+		template <class ChType>
 		friend class detail::Parser;
+		template <const arger::StaticConfig& Config>
+		friend class arger::StaticParsed;
 	private:
-		std::set<std::wstring> pFlags;
-		std::map<std::wstring, std::vector<arger::Value>> pOptions;
+		std::shared_ptr<const detail::OptionIds> pIds;
+		std::vector<uint64_t> pFlags;
+		std::vector<arger::Value> pValues;
+		std::vector<size_t> pOffsets;
 		std::vector<arger::Value> pPositional;
+		std::vector<uint64_t> pUNums;
+		std::vector<int64_t> pINums;
+		std::vector<double> pReals;
+		std::vector<std::pair<size_t, size_t>> pPacked;
+		std::pair<size_t, size_t> pPackedPositional;
+		arger::Primitive pPackedPositionalType = arger::Primitive::any;
 		std::wstring pGroupId;
 
+	private:
+		constexpr bool fValid(const arger::OptionId& id) const {
+			return (!pOffsets.empty() && id.index < pOffsets.size() - 1);
+		}
+		arger::Value fPackedValue(arger::Primitive type, size_t index) const {
+			if (type == arger::Primitive::unum)
+				return arger::Value{ pUNums[index] };
+			if (type == arger::Primitive::inum)
+				return arger::Value{ pINums[index] };
+			return arger::Value{ pReals[index] };
+		}
+		template <class Type>
+		std::span<const Type> fPackedSpan(arger::Primitive actual, const std::pair<size_t, size_t>& range) const {
+			static constexpr arger::Primitive Expected = (std::is_same_v<Type, uint64_t> ? arger::Primitive::unum : (std::is_same_v<Type, int64_t> ? arger::Primitive::inum : arger::Primitive::real));
+			if (actual != Expected) {
+				if constexpr (Expected == arger::Primitive::unum)
+					throw arger::TypeException{ L"Values are not packed as unsigned-numbers." };
+				else if constexpr (Expected == arger::Primitive::inum)
+					throw arger::TypeException{ L"Values are not packed as signed-numbers." };
+				else
+					throw arger::TypeException{ L"Values are not packed as reals." };
+			}
+			if constexpr (Expected == arger::Primitive::unum)
+				return std::span<const Type>{ pUNums.data() + range.first, range.second };
+			else if constexpr (Expected == arger::Primitive::inum)
+				return std::span<const Type>{ pINums.data() + range.first, range.second };
+			else
+				return std::span<const Type>{ pReals.data() + range.first, range.second };
+		}
+		template <class Type>
+		std::span<const Type> fPackedOption(const arger::OptionId& id) const {
+			if (!fValid(id))
+				return {};
+			return fPackedSpan<Type>(pIds->packed[id.index], pPacked[id.index]);
+		}
+
 	public:
+		arger::OptionId id(const std::wstring_view& name) const {
+			return arger::OptionId{ pIds == 0 ? detail::NoName : pIds->table.find(name) };
+		}
 		bool flag(const std::wstring& name) const {
-			return pFlags.contains(name);
+			return flag(id(name));
+		}
+		constexpr bool flag(const arger::OptionId& id) const {
+			if (!fValid(id))
+				return false;
+			return ((pFlags[id.index / 64] >> (id.index % 64)) & 0x01) != 0;
 		}
 		constexpr const std::wstring& groupId() const {
 			return pGroupId;
@@ -26,22 +87,89 @@ namespace arger {
 
 	public:
 		size_t options(const std::wstring& name) const {
-			auto it = pOptions.find(name);
-			return (it == pOptions.end() ? 0 : it->second.size());
+			return options(id(name));
+		}
+		constexpr size_t options(const arger::OptionId& id) const {
+			return (fValid(id) ? pOffsets[id.index + 1] - pOffsets[id.index] + pPacked[id.index].second : 0);
 		}
 		std::optional<arger::Value> option(const std::wstring& name, size_t index = 0) const {
-			auto it = pOptions.find(name);
-			if (it == pOptions.end() || index >= it->second.size())
+			return option(id(name), index);
+		}
+		std::optional<arger::Value> option(const arger::OptionId& id, size_t index = 0) const {
+			if (index >= options(id))
+				return {};
+			if (pPacked[id.index].second > 0)
+				return fPackedValue(pIds->packed[id.index], pPacked[id.index].first + index);
+			return pValues[pOffsets[id.index] + index];
+		}
+		std::span<const arger::Value> optionValues(const std::wstring& name) const {
+			return optionValues(id(name));
+		}
+		constexpr std::span<const arger::Value> optionValues(const arger::OptionId& id) const {
+			if (!fValid(id))
 				return {};
-			return it->second[index];
+			return std::span<const arger::Value>{ pValues.data() + pOffsets[id.index], pOffsets[id.index + 1] - pOffsets[id.index] };
+		}
+		const arger::Value* optionPtr(const std::wstring& name, size_t index = 0) const {
+			return optionPtr(id(name), index);
+		}
+		constexpr const arger::Value* optionPtr(const arger::OptionId& id, size_t index = 0) const {
+			if (!fValid(id) || index >= pOffsets[id.index + 1] - pOffsets[id.index])
+				return 0;
+			return &pValues[pOffsets[id.index] + index];
+		}
+
+	public:
+		/* access the values of packed options in their native type (arger::TypeException, if the option is not packed as the type) */
+		std::span<const uint64_t> unums(const std::wstring& name) const {
+			return fPackedOption<uint64_t>(id(name));
+		}
+		std::span<const uint64_t> unums(const arger::OptionId& id) const {
+			return fPackedOption<uint64_t>(id);
+		}
+		std::span<const int64_t> inums(const std::wstring& name) const {
+			return fPackedOption<int64_t>(id(name));
+		}
+		std::span<const int64_t> inums(const arger::OptionId& id) const {
+			return fPackedOption<int64_t>(id);
+		}
+		std::span<const double> reals(const std::wstring& name) const {
+			return fPackedOption<double>(id(name));
 		}
+		std::span<const double> reals(const arger::OptionId& id) const {
+			return fPackedOption<double>(id);
+		}
+
+	public:
 		constexpr size_t positionals() const {
-			return pPositional.size();
+			return pPositional.size() + pPackedPositional.second;
 		}
 		std::optional<arger::Value> positional(size_t index) const {
-			if (index >= pPositional.size())
+			if (index >= positionals())
 				return {};
+			if (index >= pPositional.size())
+				return fPackedValue(pPackedPositionalType, pPackedPositional.first + index - pPositional.size());
 			return pPositional[index];
 		}
+		constexpr std::span<const arger::Value> positionalValues() const {
+			return pPositional;
+		}
+		constexpr const arger::Value* positionalPtr(size_t index) const {
+			if (index >= pPositional.size())
+				return 0;
+			return &pPositional[index];
+		}
+
+	public:
+		/* access the values of the packed catch-all positional in their native type (arger::TypeException, if not packed as the type) */
+		std::span<const uint64_t> positionalUNums() const {
+			return fPackedSpan<uint64_t>(pPackedPositionalType, pPackedPositional);
+		}
+		std::span<const int64_t> positionalINums() const {
+			return fPackedSpan<int64_t>(pPackedPositionalType, pPackedPositional);
+		}
+		std::span<const double> positionalReals() const {
+			return fPackedSpan<double>(pPackedPositionalType, pPackedPositional);
+		}
 	};
 }
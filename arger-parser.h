@@ -6,60 +6,119 @@
 #include "arger-config.h"
 #include "arger-verify.h"
 #include "arger-help.h"
+#include "arger-simd.h"
 
 namespace arger {
 	namespace detail {
+		/* object of a user-defined structure, into which bound values are written (see arger::Bind) */
+		struct BindTarget {
+			void* object = 0;
+			const std::type_info* type = 0;
+		};
+
+		/* parser over the arguments of the given character type, which only widens the strings, which are actually stored, and names with
+		*	non-ascii characters, which are looked up (ascii names of options and groups are resolved in their original encoding)
+		*	(if the parser owns the arguments, stored arguments are moved into the parsed values, instead of being copied, and
+		*	packed values are never stored as strings, but converted from the arguments directly into their native type) */
+		template <class ChType>
 		class Parser {
 		private:
-			const std::vector<std::wstring>& pArgs;
-			detail::ValidConfig pConfig;
+			using View = std::basic_string_view<ChType>;
+
+		private:
+			std::vector<std::wstring> pOwned;
+			std::vector<View> pArgs;
+			const arger::CompiledConfig& pCompiled;
+			const detail::ValidConfig& pConfig;
 			const detail::ValidGroup* pSelected = 0;
 			arger::Parsed pParsed;
+			std::vector<std::pair<size_t, arger::Value>> pPending;
+			std::vector<std::pair<size_t, View>> pPendingPacked;
+			std::vector<View> pPackedViews;
+			std::vector<size_t> pPackedOffsets;
+			std::vector<size_t> pPositionalArgs;
+			detail::BindTarget pTarget;
 			std::wstring pDeferred;
 			size_t pIndex = 0;
 			bool pPrintHelp = false;
 			bool pPrintVersion = false;
 			bool pPositionalLocked = false;
+			bool pBorrow = false;
 
 		public:
-			Parser(const std::vector<std::wstring>& args) : pArgs{ args } {}
+			Parser(std::vector<View>&& args, const arger::CompiledConfig& config, bool borrow, detail::BindTarget target) : pArgs{ std::move(args) }, pCompiled{ config }, pConfig{ config.pValid }, pTarget{ target }, pBorrow{ borrow } {}
+			Parser(std::vector<std::wstring>&& args, const arger::CompiledConfig& config, detail::BindTarget target) requires std::is_same_v<ChType, wchar_t> : pOwned{ std::move(args) }, pCompiled{ config }, pConfig{ config.pValid }, pTarget{ target } {
+				pArgs.assign(pOwned.begin(), pOwned.end());
+			}
 
 		private:
-			void fParseOptional(const std::wstring& arg, const std::wstring& payload, bool fullName, bool hasPayload) {
+			static constexpr bool fDirect(const View& view) {
+				/* check if the view can be looked up without being widened (wide views, or narrow views of only ascii characters) */
+				if constexpr (std::is_same_v<ChType, wchar_t>)
+					return true;
+				else {
+					for (ChType c : view) {
+						if (std::make_unsigned_t<ChType>(c) >= 0x80)
+							return false;
+					}
+					return true;
+				}
+			}
+			static std::wstring fWiden(const View& view) {
+				if constexpr (std::is_same_v<ChType, wchar_t>)
+					return std::wstring{ view };
+				else
+					return str::wd::To(view);
+			}
+			arger::Value fStore(const View& view) const {
+				/* either reference the original argument or widen it into its own string */
+				if (pBorrow)
+					return arger::Value{ detail::BorrowedStr{ view.data(), view.size(), &detail::DecodeBorrowed<ChType>, {} } };
+				return arger::Value{ fWiden(view) };
+			}
+			arger::Value fStore(size_t index) {
+				/* move owned arguments out (the view must not be accessed anymore afterwards) */
+				if constexpr (std::is_same_v<ChType, wchar_t>) {
+					if (!pOwned.empty())
+						return arger::Value{ std::move(pOwned[index]) };
+				}
+				return fStore(pArgs[index]);
+			}
+			template <class NameType>
+			void fParseOptional(const std::basic_string_view<NameType>& arg, const View& payload, bool fullName, bool hasPayload) {
 				bool payloadUsed = false;
 
 				/* iterate over the list of optional abbreviations/single full-name and process them */
 				for (size_t i = 0; i < arg.size(); ++i) {
-					detail::ValidOption* entry = 0;
+					const detail::ValidOption* entry = 0;
 
 					/* resolve the optional-argument entry, depending on it being a short abbreviation, or a full name */
 					if (fullName) {
-						auto it = pConfig.options.find(arg);
-						if (it == pConfig.options.end()) {
+						entry = detail::FindOption(pConfig, arg);
+						if (entry == 0) {
 							if (pDeferred.empty())
 								str::BuildTo(pDeferred, L"Unknown optional argument [", arg, L"] encountered.");
 
 							/* continue parsing, as the special purpose flags might still occur */
 							continue;
 						}
-						entry = &it->second;
 						i = arg.size();
 					}
 					else {
-						auto it = pConfig.abbreviations.find(arg[i]);
-						if (it == pConfig.abbreviations.end()) {
+						entry = detail::FindAbbreviation(pConfig, wchar_t(arg[i]));
+						if (entry == 0) {
 							if (pDeferred.empty())
-								str::BuildTo(pDeferred, L"Unknown optional argument-abbreviation [", arg[i], L"] encountered.");
+								str::BuildTo(pDeferred, L"Unknown optional argument-abbreviation [", wchar_t(arg[i]), L"] encountered.");
 
 							/* continue parsing, as the special purpose flags might still occur */
 							continue;
 						}
-						entry = it->second;
 					}
 
 					/* check if this is a flag and mark it as seen and check if its a special purpose argument */
+					size_t id = size_t(entry - pConfig.options.data());
 					if (!entry->payload) {
-						pParsed.pFlags.insert(entry->option->name);
+						pParsed.pFlags[id / 64] |= (uint64_t(1) << (id % 64));
 						if (entry->option->flagHelp)
 							pPrintHelp = true;
 						else if (entry->option->flagVersion)
@@ -77,24 +136,159 @@ namespace arger {
 					}
 					payloadUsed = true;
 
-					/* write the value as raw string into the buffer (dont perform any validations or limit checks for now) */
-					auto it = pParsed.pOptions.find(entry->option->name);
-					if (it == pParsed.pOptions.end())
-						it = pParsed.pOptions.insert({ entry->option->name, {} }).first;
-					it->second.emplace_back(arger::Value{ hasPayload ? payload : pArgs[pIndex++] });
+					/* split lists into their separate values */
+					if (entry->option->separator != 0) {
+						fSplitList(*entry, id, hasPayload ? payload : pArgs[pIndex++]);
+						continue;
+					}
+
+					/* write the value as raw string into the pending values (dont perform any validations or limit
+					*	checks for now, as the values are only sorted into the contiguous layout once all are known) */
+					if (pConfig.optionIds->packed[id] != arger::Primitive::any)
+						pPendingPacked.emplace_back(id, hasPayload ? payload : pArgs[pIndex++]);
+					else
+						pPending.emplace_back(id, hasPayload ? fStore(payload) : fStore(pIndex++));
 				}
 
 				/* check if a payload was supplied but not consumed */
 				if (hasPayload && !payloadUsed && pDeferred.empty())
-					str::BuildTo(pDeferred, L"Value [", payload, L"] not used by optional arguments.");
+					str::BuildTo(pDeferred, L"Value [", fWiden(payload), L"] not used by optional arguments.");
+			}
+
+			void fSplitList(const detail::ValidOption& entry, size_t id, const View& list) {
+				/* split the list via a vectorized scan for the separator and write the values as raw strings into the pending
+				*	values (packed values are only referenced, and are converted in bulk, once the limits have been checked) */
+				bool packed = (pConfig.optionIds->packed[id] != arger::Primitive::any);
+				for (size_t offset = 0;; ++offset) {
+					size_t end = detail::FindSeparator(list.data(), list.size(), offset, entry.option->separator);
+
+					/* reject empty values (such as trailing separators), as they are most likely not intended */
+					if (end == offset) {
+						if (pDeferred.empty())
+							str::BuildTo(pDeferred, L"List of argument [", entry.option->name, L"] contains an empty value.");
+						return;
+					}
+					if (packed)
+						pPendingPacked.emplace_back(id, list.substr(offset, end - offset));
+					else
+						pPending.emplace_back(id, fStore(list.substr(offset, end - offset)));
+					if ((offset = end) >= list.size())
+						break;
+				}
 			}
 
 		private:
+			template <class NumType, class Type>
+			static constexpr bool fParseNum(const std::basic_string_view<Type>& view, NumType& out) {
+				auto [num, len, res] = str::ParseNum<NumType>(view, 10, str::PrefixMode::overwrite);
+				out = num;
+				return (res == str::NumResult::valid && len == view.size());
+			}
+			template <class NumType>
+			static constexpr bool fParseNum(const arger::Value& value, NumType& out) {
+				/* parse borrowed arguments directly without decoding them */
+				if (const detail::BorrowedStr* borrowed = value.fBorrowed(); borrowed != 0)
+					return fParseNum(View{ static_cast<const ChType*>(borrowed->data), borrowed->size }, out);
+				return fParseNum(std::wstring_view{ value.str() }, out);
+			}
+			static void fConvertLazy(const detail::LazyNum& lazy) {
+				/* parse borrowed arguments directly without decoding them (same validation as for eagerly converted values) */
+				const detail::BorrowedStr* borrowed = std::get_if<detail::BorrowedStr>(&lazy.raw);
+				auto parse = [&](auto& num) -> bool {
+					if (borrowed != 0)
+						return fParseNum(View{ static_cast<const ChType*>(borrowed->data), borrowed->size }, num);
+					return fParseNum(std::wstring_view{ std::get<std::wstring>(lazy.raw) }, num);
+				};
+
+				if (lazy.source->type == arger::Primitive::unum) {
+					uint64_t num = 0;
+					if (!parse(num))
+						throw arger::ParsingException{ L"Invalid unsigned integer for argument [", lazy.source->name, L"] encountered." };
+					lazy.converted = num;
+				}
+				else if (lazy.source->type == arger::Primitive::inum) {
+					int64_t num = 0;
+					if (!parse(num))
+						throw arger::ParsingException{ L"Invalid signed integer for argument [", lazy.source->name, L"] encountered." };
+					if (num >= 0)
+						lazy.converted = uint64_t(num);
+					else
+						lazy.converted = num;
+				}
+				else {
+					double num = 0;
+					if (!parse(num))
+						throw arger::ParsingException{ L"Invalid real for argument [", lazy.source->name, L"] encountered." };
+					lazy.converted = num;
+				}
+			}
+			static void fDeferValues(const std::wstring& name, std::span<arger::Value> values, arger::Primitive type) {
+				/* move the raw strings of all values of the argument into a single shared source (default values are already converted) */
+				std::shared_ptr<detail::LazySource> source = std::make_shared<detail::LazySource>(detail::LazySource{ name, type, &fConvertLazy, {} });
+				source->values.reserve(values.size());
+				for (arger::Value& value : values) {
+					if (!value.isStr())
+						continue;
+					detail::LazyNum& lazy = source->values.emplace_back(detail::LazyNum{ {}, source.get(), {} });
+					if (const detail::BorrowedStr* borrowed = value.fBorrowed(); borrowed != 0)
+						lazy.raw = *borrowed;
+					else
+						lazy.raw = std::move(value).str();
+					value = arger::Value{ std::shared_ptr<const detail::LazyNum>{ source, &lazy } };
+				}
+			}
+			size_t fReservePacked(arger::Primitive type, size_t count) {
+				/* append the range to the vector of the native type and return its offset */
+				size_t offset = 0;
+				if (type == arger::Primitive::unum)
+					pParsed.pUNums.resize((offset = pParsed.pUNums.size()) + count);
+				else if (type == arger::Primitive::inum)
+					pParsed.pINums.resize((offset = pParsed.pINums.size()) + count);
+				else
+					pParsed.pReals.resize((offset = pParsed.pReals.size()) + count);
+				return offset;
+			}
+			void fSetPacked(arger::Primitive type, size_t index, const arger::Value& value) {
+				if (type == arger::Primitive::unum)
+					pParsed.pUNums[index] = value.unum();
+				else if (type == arger::Primitive::inum)
+					pParsed.pINums[index] = value.inum();
+				else
+					pParsed.pReals[index] = value.real();
+			}
+			void fParsePacked(const std::wstring& name, arger::Primitive type, size_t index, const View& view) {
+				/* parse the argument directly into the native type (same validation as for unpacked values) */
+				if (type == arger::Primitive::unum) {
+					if (!fParseNum(view, pParsed.pUNums[index]))
+						throw arger::ParsingException{ L"Invalid unsigned integer for argument [", name, L"] encountered." };
+				}
+				else if (type == arger::Primitive::inum) {
+					if (!fParseNum(view, pParsed.pINums[index]))
+						throw arger::ParsingException{ L"Invalid signed integer for argument [", name, L"] encountered." };
+				}
+				else if (!fParseNum(view, pParsed.pReals[index]))
+					throw arger::ParsingException{ L"Invalid real for argument [", name, L"] encountered." };
+			}
+			static bool fResolveEnum(arger::Value& value, const arger::Type& type) {
+				/* replace the matched string by its index within the enum (the value only references the name within the shared enum) */
+				if (!std::holds_alternative<arger::Enum>(type) || !value.isStr())
+					return false;
+				const arger::Enum& allowed = std::get<arger::Enum>(type);
+				size_t index = allowed.index(value.view());
+				if (index == detail::NoName)
+					return false;
+				value = arger::Value{ allowed.fRef(index, value.view()) };
+				return true;
+			}
+			static void fResolveDefault(arger::Value& value, const arger::Type& type) {
+				/* defaults of externally backed enums are not resolved, in order to only query the provider for given values */
+				if (std::holds_alternative<arger::Enum>(type) && std::get<arger::Enum>(type).provider() == 0)
+					fResolveEnum(value, type);
+			}
 			constexpr void fVerifyValue(const std::wstring& name, arger::Value& value, const arger::Type& type) const {
 				/* check if an enum was expected */
 				if (std::holds_alternative<arger::Enum>(type)) {
-					const arger::Enum& allowed = std::get<arger::Enum>(type);
-					if (allowed.count(value.str()) != 0)
+					if (fResolveEnum(value, type))
 						return;
 					throw arger::ParsingException{ L"Invalid enum for argument [", name, L"] encountered." };
 				}
@@ -102,22 +296,22 @@ namespace arger {
 				/* validate the expected type and found value */
 				switch (std::get<arger::Primitive>(type)) {
 				case arger::Primitive::inum: {
-					auto [num, len, res] = str::ParseNum<int64_t>(value.str(), 10, str::PrefixMode::overwrite);
-					if (res != str::NumResult::valid || len != value.str().size())
+					int64_t num = 0;
+					if (!fParseNum(value, num))
 						throw arger::ParsingException{ L"Invalid signed integer for argument [", name, L"] encountered." };
 					value = arger::Value{ num };
 					break;
 				}
 				case arger::Primitive::unum: {
-					auto [num, len, res] = str::ParseNum<uint64_t>(value.str(), 10, str::PrefixMode::overwrite);
-					if (res != str::NumResult::valid || len != value.str().size())
+					uint64_t num = 0;
+					if (!fParseNum(value, num))
 						throw arger::ParsingException{ L"Invalid unsigned integer for argument [", name, L"] encountered." };
 					value = arger::Value{ num };
 					break;
 				}
 				case arger::Primitive::real: {
-					auto [num, len, res] = str::ParseNum<double>(value.str(), 10, str::PrefixMode::overwrite);
-					if (res != str::NumResult::valid || len != value.str().size())
+					double num = 0;
+					if (!fParseNum(value, num))
 						throw arger::ParsingException{ L"Invalid real for argument [", name, L"] encountered." };
 					value = arger::Value{ num };
 					break;
@@ -145,78 +339,229 @@ namespace arger {
 				if (topMost->incomplete)
 					throw arger::ParsingException{ str::View{ topMost->groupName }.title(), L" missing." };
 
+				/* check if the catch-all positional is packed, in which case its values are converted directly into the native type */
+				const auto& positionals = topMost->args->positionals;
+				size_t packedFrom = (topMost->args->packed ? positionals.size() - 1 : std::numeric_limits<size_t>::max());
+				if (topMost->args->packed) {
+					pParsed.pPackedPositionalType = std::get<arger::Primitive>(positionals.back().type);
+					if (packedFrom < pPositionalArgs.size())
+						pParsed.pPackedPositional = { fReservePacked(pParsed.pPackedPositionalType, pPositionalArgs.size() - packedFrom), pPositionalArgs.size() - packedFrom };
+				}
+
 				/* validate the requirements for the positional arguments and parse their values */
-				for (size_t i = 0; i < pParsed.pPositional.size(); ++i) {
+				for (size_t i = 0; i < pPositionalArgs.size(); ++i) {
+					View arg = pArgs[pPositionalArgs[i]];
+
 					/* check if the argument is out of range */
-					if (topMost->args->positionals.empty() || (topMost->maximum > 0 && i >= topMost->maximum)) {
+					if (positionals.empty() || (topMost->maximum > 0 && i >= topMost->maximum)) {
 						if (pSelected == 0)
-							throw arger::ParsingException{ L"Unrecognized argument [", pParsed.pPositional[i].str(), L"] encountered." };
-						throw arger::ParsingException{ L"Unrecognized argument [", pParsed.pPositional[i].str(), L"] encountered for ", topMost->super->groupName, L" [", pSelected->group->name, L"]." };
+							throw arger::ParsingException{ L"Unrecognized argument [", fWiden(arg), L"] encountered." };
+						throw arger::ParsingException{ L"Unrecognized argument [", fWiden(arg), L"] encountered for ", topMost->super->groupName, L" [", pSelected->group->name, L"]." };
 					}
-					size_t index = std::min<size_t>(i, topMost->args->positionals.size() - 1);
+					size_t index = std::min<size_t>(i, positionals.size() - 1);
 
 					/* check if the default value should be used and otherwise validate the argument (default will already be validated) */
-					if (pParsed.pPositional[i].str().empty() && topMost->args->positionals[index].defValue.has_value())
-						pParsed.pPositional[i] = topMost->args->positionals[index].defValue.value();
-					else
-						fVerifyValue(topMost->args->positionals[index].name, pParsed.pPositional[i], topMost->args->positionals[index].type);
+					bool useDefault = (arg.empty() && positionals[index].defValue.has_value());
+					if (i >= packedFrom) {
+						if (useDefault)
+							fSetPacked(pParsed.pPackedPositionalType, pParsed.pPackedPositional.first + i - packedFrom, positionals[index].defValue.value());
+						else
+							fParsePacked(positionals[index].name, pParsed.pPackedPositionalType, pParsed.pPackedPositional.first + i - packedFrom, arg);
+					}
+					else if (useDefault) {
+						pParsed.pPositional.push_back(positionals[index].defValue.value());
+						fResolveDefault(pParsed.pPositional.back(), positionals[index].type);
+					}
+					else {
+						pParsed.pPositional.push_back(fStore(pPositionalArgs[i]));
+						if (!topMost->args->lazyConvert || !detail::IsNumeric(positionals[index].type))
+							fVerifyValue(positionals[index].name, pParsed.pPositional.back(), positionals[index].type);
+					}
+				}
+
+				/* defer the conversion of the numeric positionals (last positional receives all remaining arguments) */
+				for (size_t i = 0; topMost->args->lazyConvert && i < positionals.size() && i < pParsed.pPositional.size(); ++i) {
+					if (!detail::IsNumeric(positionals[i].type))
+						continue;
+					size_t end = (i + 1 == positionals.size() ? pParsed.pPositional.size() : i + 1);
+					fDeferValues(positionals[i].name, { pParsed.pPositional.begin() + i, pParsed.pPositional.begin() + end }, std::get<arger::Primitive>(positionals[i].type));
 				}
 
 				/* fill up on default values (will already be validated) */
-				for (size_t i = pParsed.pPositional.size(); i < topMost->args->positionals.size(); ++i) {
-					if (!topMost->args->positionals[i].defValue.has_value())
+				for (size_t i = pParsed.positionals(); i < positionals.size(); ++i) {
+					if (!positionals[i].defValue.has_value())
 						break;
-					pParsed.pPositional.push_back(topMost->args->positionals[i].defValue.value());
+					if (i < packedFrom) {
+						pParsed.pPositional.push_back(positionals[i].defValue.value());
+						fResolveDefault(pParsed.pPositional.back(), positionals[i].type);
+					}
+					else {
+						pParsed.pPackedPositional = { fReservePacked(pParsed.pPackedPositionalType, 1), 1 };
+						fSetPacked(pParsed.pPackedPositionalType, pParsed.pPackedPositional.first, positionals[i].defValue.value());
+					}
 				}
 
 				/* check if the minimum required number of parameters has not been reached
 				*	(maximum not necessary to be checked, as it will be checked implicitly by the verification-loop) */
-				if (pParsed.pPositional.size() < topMost->minimum) {
-					size_t index = std::min<size_t>(topMost->args->positionals.size() - 1, pParsed.pPositional.size());
+				if (pParsed.positionals() < topMost->minimum) {
+					size_t index = std::min<size_t>(positionals.size() - 1, pParsed.positionals());
 					if (pSelected == 0)
 						throw arger::ParsingException{ L"Argument [", topMost->args->positionals[index].name, L"] is missing." };
 					throw arger::ParsingException{ L"Argument [", topMost->args->positionals[index].name, L"] is missing for ", topMost->super->groupName, L" [", pSelected->group->name, L"]." };
 				}
 			}
+			bool fBound(const detail::Binding& binding, const std::wstring& name) const {
+				if (pTarget.object == 0 || !binding.convert)
+					return false;
+				if (*binding.owner != *pTarget.type)
+					throw arger::ConfigException{ L"Argument [", name, L"] is bound to a member of a different structure." };
+				return true;
+			}
+			size_t fCount(size_t id) const {
+				return (pParsed.pOffsets[id + 1] - pParsed.pOffsets[id]) + pParsed.pPacked[id].second;
+			}
+			arger::Value& fSlot(size_t id, size_t index) {
+				return pParsed.pValues[pParsed.pOffsets[id] + index];
+			}
+			void fLayoutOptional(const detail::ValidArguments* topMost, std::vector<size_t>& given) {
+				std::vector<size_t>& offsets = pParsed.pOffsets;
+
+				/* count the values per option and add the default values of all options usable by the current group, which have not been given */
+				given.assign(pConfig.options.size(), 0);
+				for (const auto& [id, _] : pPending)
+					++given[id];
+				for (const auto& [id, _] : pPendingPacked)
+					++given[id];
+				offsets.assign(pConfig.options.size() + 1, 0);
+				pPackedOffsets.assign(pConfig.options.size() + 1, 0);
+				pParsed.pPacked.assign(pConfig.options.size(), { 0, 0 });
+				for (size_t i = 0; i < pConfig.options.size(); ++i) {
+					const detail::ValidOption& option = pConfig.options[i];
+					size_t count = given[i];
+					if (count == 0 && option.payload && (!option.restricted || option.users[topMost->index]))
+						count = option.option->payload.defValue.size();
+					bool packed = (pConfig.optionIds->packed[i] != arger::Primitive::any);
+					if (packed)
+						pParsed.pPacked[i] = { fReservePacked(pConfig.optionIds->packed[i], count), count };
+					offsets[i + 1] = offsets[i] + (packed ? 0 : count);
+					pPackedOffsets[i + 1] = pPackedOffsets[i] + (packed ? given[i] : 0);
+				}
+
+				/* move the pending values into their ranges (in order of occurrence) and copy the default values
+				*	(the packed arguments are only sorted, as they are converted once the limits have been checked) */
+				pParsed.pValues.resize(offsets.back());
+				pPackedViews.resize(pPackedOffsets.back());
+				std::vector<size_t> next(pConfig.options.size(), 0);
+				for (auto& [id, value] : pPending)
+					fSlot(id, next[id]++) = std::move(value);
+				for (const auto& [id, view] : pPendingPacked)
+					pPackedViews[pPackedOffsets[id] + next[id]++] = view;
+				pPending.clear();
+				pPendingPacked.clear();
+				for (size_t i = 0; i < pConfig.options.size(); ++i) {
+					if (given[i] != 0)
+						continue;
+					const std::vector<arger::Value>& defValue = pConfig.options[i].option->payload.defValue;
+					for (size_t j = 0; j < pParsed.pPacked[i].second; ++j)
+						fSetPacked(pConfig.optionIds->packed[i], pParsed.pPacked[i].first + j, defValue[j]);
+					if (pParsed.pPacked[i].second > 0)
+						continue;
+					for (size_t j = 0; j < fCount(i); ++j) {
+						fSlot(i, j) = defValue[j];
+						fResolveDefault(fSlot(i, j), pConfig.options[i].option->payload.type);
+					}
+				}
+			}
 			void fVerifyOptional() {
 				const detail::ValidArguments* topMost = (pSelected == 0 ? static_cast<const detail::ValidArguments*>(&pConfig) : pSelected);
 
+				/* setup the contiguous layout of all option values */
+				std::vector<size_t> given;
+				fLayoutOptional(topMost, given);
+
 				/* iterate over the optional arguments and verify them */
-				for (auto& [name, option] : pConfig.options) {
+				for (size_t i = 0; i < pConfig.options.size(); ++i) {
+					const detail::ValidOption& option = pConfig.options[i];
+					const std::wstring& name = option.option->name;
+					size_t count = fCount(i);
+
 					/* check if the current group is not a user of the optional argument (restricted can
-					*	only be true if groups exist and the null-group is contained at all times) */
-					if (option.restricted && !option.users.contains(pSelected)) {
-						if ((option.payload ? pParsed.pOptions.contains(name) : pParsed.pFlags.contains(name)))
+					*	only be true if groups exist and the root-group is contained at all times) */
+					if (option.restricted && !option.users[topMost->index]) {
+						if ((option.payload ? count > 0 : pParsed.flag(arger::OptionId{ i })))
 							throw arger::ParsingException{ L"Argument [", name, L"] not meant for ", topMost->super->groupName, L" [", pSelected->group->name, L"]." };
 						continue;
 					}
 
-					/* check if this is a flag, in which case nothing more needs to be checked */
+					/* check if this is a flag, in which case nothing needs to be verified */
 					if (!option.payload)
 						continue;
 
-					/* lookup the option */
-					auto it = pParsed.pOptions.find(name);
-					size_t count = (it == pParsed.pOptions.end() ? 0 : it->second.size());
-
-					/* check if the default values should be assigned (are already validated by the verifying-step) */
-					if (count == 0 && !option.option->payload.defValue.empty()) {
-						pParsed.pOptions.insert({ name, {} }).first->second = option.option->payload.defValue;
+					/* check if the default values have been assigned (are already validated by the verifying-step) */
+					if (given[i] == 0 && count > 0)
 						continue;
-					}
 
-					/* check if the optional-argument has been found */
-					if (option.minimum > count)
+					/* check if the optional-argument has been found (lists are limited by their number of values instead) */
+					if (option.minimum > count) {
+						if (option.option->separator != 0 && count > 0)
+							throw arger::ParsingException{ L"Argument [", name, L"] requires at least ", option.minimum, L" values." };
 						throw arger::ParsingException{ L"Argument [", name, L"] is missing." };
+					}
 
 					/* check if too many instances were found */
-					if (option.maximum > 0 && count > option.maximum)
+					if (option.maximum > 0 && count > option.maximum) {
+						if (option.option->separator != 0)
+							throw arger::ParsingException{ L"Argument [", name, L"] can at most have ", option.maximum, L" values." };
 						throw arger::ParsingException{ L"Argument [", name, L"] can at most be specified ", option.maximum, " times." };
+					}
+
+					/* verify the values themselves (packed values are converted into their native type, and lazy values once accessed) */
+					if (pParsed.pPacked[i].second > 0) {
+						for (size_t j = 0; j < count; ++j)
+							fParsePacked(name, pConfig.optionIds->packed[i], pParsed.pPacked[i].first + j, pPackedViews[pPackedOffsets[i] + j]);
+						continue;
+					}
+					if (option.option->lazyConvert && detail::IsNumeric(option.option->payload.type) && count > 0)
+						fDeferValues(name, { &fSlot(i, 0), count }, std::get<arger::Primitive>(option.option->payload.type));
+					else {
+						for (size_t j = 0; j < count; ++j)
+							fVerifyValue(name, fSlot(i, j), option.option->payload.type);
+					}
+				}
+			}
+			void fAssignBound(const detail::ValidArguments* topMost) {
+				if (pTarget.object == 0)
+					return;
 
-					/* verify the values themselves */
-					for (size_t i = 0; i < count; ++i)
-						fVerifyValue(name, it->second[i], option.option->payload.type);
+				/* convert copies of the values of all options usable by the current group for their bound members (flags write their
+				*	state, and options without values leave their members untouched, while the values remain accessible by id) */
+				std::vector<std::function<void(void*)>> assignments;
+				for (size_t i = 0; i < pConfig.options.size(); ++i) {
+					const detail::ValidOption& option = pConfig.options[i];
+					if (!fBound(option.option->binding, option.option->name) || (option.restricted && !option.users[topMost->index]))
+						continue;
+					std::vector<arger::Value> values;
+					if (!option.payload)
+						values.emplace_back(pParsed.flag(arger::OptionId{ i }));
+					else
+						values.assign(pParsed.pValues.begin() + pParsed.pOffsets[i], pParsed.pValues.begin() + pParsed.pOffsets[i + 1]);
+					if (!values.empty())
+						assignments.push_back(option.option->binding.convert(values, option.option->name));
 				}
+
+				/* convert copies of the positionals for their bound members (last positional receives all remaining arguments, and the values remain accessible by index) */
+				const auto& positionals = topMost->args->positionals;
+				for (size_t i = 0; i < positionals.size() && i < pParsed.pPositional.size(); ++i) {
+					if (!fBound(positionals[i].binding, positionals[i].name))
+						continue;
+					size_t end = (i + 1 == positionals.size() ? pParsed.pPositional.size() : i + 1);
+					std::vector<arger::Value> values{ pParsed.pPositional.begin() + i, pParsed.pPositional.begin() + end };
+					assignments.push_back(positionals[i].binding.convert(values, positionals[i].name));
+				}
+
+				/* write the converted values to the target (only once all conversions have succeeded, as the target is otherwise left untouched) */
+				for (auto& assign : assignments)
+					assign(pTarget.object);
 			}
 			void fRecCheckConstraints(const detail::ValidArguments* args) {
 				if (args == 0)
@@ -231,65 +576,69 @@ namespace arger {
 			}
 
 		public:
-			arger::Parsed parse(const arger::Config& config, bool menu) {
+			arger::Parsed parse(bool menu) {
 				const detail::ValidArguments* topMost = static_cast<const detail::ValidArguments*>(&pConfig);
 
-				/* validate and pre-process the configuration */
-				detail::ValidateConfig(config, pConfig, menu);
+				/* setup the id-indexed layout of the parsed results */
+				pParsed.pIds = pConfig.optionIds;
+				pParsed.pFlags.assign((pConfig.options.size() + 63) / 64, 0);
 
-				/* extract the program name */
-				detail::BaseBuilder base{ pArgs.empty() || menu ? L"" : pArgs[pIndex++], config, menu };
+				/* extract the program name (configuration has already been validated and pre-processed) */
+				detail::BaseBuilder base{ pArgs.empty() || menu ? L"" : fWiden(pArgs[pIndex++]), *pConfig.config, menu };
 
 				/* iterate over the arguments and parse them based on the definitions */
-				size_t dirtyGroup = pArgs.size();
+				std::optional<std::wstring> dirtyGroup;
 				while (pIndex < pArgs.size()) {
-					const std::wstring& next = pArgs[pIndex++];
+					View next = pArgs[pIndex++];
 
 					/* check if its an optional argument or positional-lock */
-					if (!pPositionalLocked && !next.empty() && next[0] == L'-') {
-						if (next == L"--") {
+					if (!pPositionalLocked && !next.empty() && next[0] == ChType('-')) {
+						if (next.size() == 2 && next[1] == ChType('-')) {
 							pPositionalLocked = true;
 							continue;
 						}
 
 						/* check if a payload is baked into the string */
-						std::wstring payload;
-						size_t end = next.size();
-						bool hasPayload = false;
-						for (size_t i = 1; i < next.size(); ++i) {
-							if (next[i] != L'=')
-								continue;
-
-							/* extract the payload and mark the actual end of the optional argument */
-							hasPayload = true;
-							payload = next.substr(i + 1);
-							end = i;
-							break;
-						}
-
-						/* parse the single long or multiple short arguments */
-						size_t hypenCount = (next.size() > 2 && next[1] == L'-' ? 2 : 1);
-						fParseOptional(next.substr(hypenCount, end - hypenCount), payload, (hypenCount == 2), hasPayload);
+						View payload;
+						size_t end = next.find(ChType('='), 1);
+						bool hasPayload = (end != View::npos);
+						if (hasPayload)
+							payload = next.substr(end + 1);
+						else
+							end = next.size();
+
+						/* parse the single long or multiple short arguments (only names with non-ascii characters are widened for the lookup) */
+						size_t hypenCount = (next.size() > 2 && next[1] == ChType('-') ? 2 : 1);
+						View name = next.substr(hypenCount, end - hypenCount);
+						if (fDirect(name))
+							fParseOptional(name, payload, (hypenCount == 2), hasPayload);
+						else
+							fParseOptional(std::wstring_view{ fWiden(name) }, payload, (hypenCount == 2), hasPayload);
 						continue;
 					}
 
 					/* check if this is a group-selector */
-					if (topMost->incomplete && dirtyGroup == pArgs.size()) {
+					if (topMost->incomplete && !dirtyGroup.has_value()) {
 						/* find the group with the matching argument-name */
-						auto it = topMost->sub.find(next);
-
-						/* check if a group has been found */
-						if (it != topMost->sub.end()) {
-							topMost = (pSelected = &it->second);
+						const detail::ValidGroup* group = 0;
+						if (fDirect(next))
+							group = detail::FindGroup(*topMost, next);
+						else
+							group = detail::FindGroup(*topMost, fWiden(next));
+
+						/* check if a group has been found (and ensure it has been fully validated) */
+						if (group != 0) {
+							pCompiled.fValidateDeferred(*group);
+							topMost = (pSelected = group);
 							continue;
 						}
-						dirtyGroup = pIndex - 1;
+						dirtyGroup = fWiden(next);
 					}
 
 					/* add the argument to the list of positional arguments (dont perform any validations or
 					*	limit checks for now, but defer it until the help/version string have been potentially
 					*	printed, in order for help to be printed without the arguments being valid) */
-					pParsed.pPositional.emplace_back(arger::Value{ next });
+					pPositionalArgs.push_back(pIndex - 1);
 				}
 
 				/* check if the top-most group is a help special purpose argument,
@@ -313,8 +662,8 @@ namespace arger {
 					throw arger::PrintMessage{ print };
 
 				/* verify the group selection */
-				if (dirtyGroup < pArgs.size())
-					throw arger::ParsingException{ L"Unknown ", topMost->groupName, L" [", pArgs[dirtyGroup], L"] encountered." };
+				if (dirtyGroup.has_value())
+					throw arger::ParsingException{ L"Unknown ", topMost->groupName, L" [", dirtyGroup.value(), L"] encountered." };
 
 				/* check if a deferred error can be thrown */
 				if (!pDeferred.empty())
@@ -333,16 +682,19 @@ namespace arger {
 				fRecCheckConstraints(topMost);
 
 				/* validate all optional constraints */
-				for (const auto& [name, option] : pConfig.options) {
-					if (!pParsed.pOptions.contains(name))
+				for (size_t i = 0; i < pConfig.options.size(); ++i) {
+					if (fCount(i) == 0)
 						continue;
-					for (const auto& fn : option.option->constraints) {
+					for (const auto& fn : pConfig.options[i].option->constraints) {
 						std::wstring err = fn(pParsed);
 						if (!err.empty())
 							throw arger::ParsingException{ err };
 					}
 				}
 
+				/* write the bound members (only once all constraints have been satisfied and all bound values have been converted) */
+				fAssignBound(topMost);
+
 				/* return the parsed structure */
 				arger::Parsed out;
 				std::swap(out, pParsed);
@@ -351,13 +703,108 @@ namespace arger {
 		};
 	}
 
+	namespace detail {
+		inline void CheckMenu(const arger::CompiledConfig& config, bool menu) {
+			if (config.menu() && !menu)
+				throw arger::ConfigException{ L"Configuration has been compiled for menu-input arguments." };
+			if (!config.menu() && menu)
+				throw arger::ConfigException{ L"Configuration has been compiled for standard program arguments." };
+		}
+		template <class ChType>
+		inline arger::Parsed ParseViews(std::vector<std::basic_string_view<ChType>>&& args, const arger::CompiledConfig& config, bool menu, bool borrow, detail::BindTarget target = {}) {
+			detail::CheckMenu(config, menu);
+			return detail::Parser<ChType>{ std::move(args), config, borrow, target }.parse(menu);
+		}
+		inline arger::Parsed ParseOwned(std::vector<std::wstring>&& args, const arger::CompiledConfig& config, bool menu, detail::BindTarget target = {}) {
+			detail::CheckMenu(config, menu);
+			return detail::Parser<wchar_t>{ std::move(args), config, target }.parse(menu);
+		}
+		template <class Type>
+		constexpr detail::BindTarget MakeTarget(Type& target) {
+			return detail::BindTarget{ &target, &typeid(Type) };
+		}
+	}
+
 	/* parse the arguments as standard program arguments */
+	inline arger::Parsed Parse(const std::vector<std::wstring>& args, const arger::CompiledConfig& config) {
+		return detail::ParseViews<wchar_t>({ args.begin(), args.end() }, config, false, false);
+	}
 	inline arger::Parsed Parse(const std::vector<std::wstring>& args, const arger::Config& config) {
-		return detail::Parser{ args }.parse(config, false);
+		return arger::Parse(args, arger::CompiledConfig{ config, false });
+	}
+
+	/* parse the arguments as standard program arguments, and move the argument strings into the parsed values */
+	inline arger::Parsed Parse(std::vector<std::wstring>&& args, const arger::CompiledConfig& config) {
+		return detail::ParseOwned(std::move(args), config, false);
+	}
+	inline arger::Parsed Parse(std::vector<std::wstring>&& args, const arger::Config& config) {
+		return arger::Parse(std::move(args), arger::CompiledConfig{ config, false });
 	}
 
 	/* parse the arguments as menu-input arguments */
+	inline arger::Parsed Menu(const std::vector<std::wstring>& args, const arger::CompiledConfig& config) {
+		return detail::ParseViews<wchar_t>({ args.begin(), args.end() }, config, true, false);
+	}
 	inline arger::Parsed Menu(const std::vector<std::wstring>& args, const arger::Config& config) {
-		return detail::Parser{ args }.parse(config, true);
+		return arger::Menu(args, arger::CompiledConfig{ config, true });
+	}
+
+	/* parse the arguments as menu-input arguments, and move the argument strings into the parsed values */
+	inline arger::Parsed Menu(std::vector<std::wstring>&& args, const arger::CompiledConfig& config) {
+		return detail::ParseOwned(std::move(args), config, true);
+	}
+	inline arger::Parsed Menu(std::vector<std::wstring>&& args, const arger::Config& config) {
+		return arger::Menu(std::move(args), arger::CompiledConfig{ config, true });
+	}
+
+	/* parse the arguments as standard program arguments, and write the values of all bound options/positionals into the target (see arger::Bind)
+	*	Note: The target is only written to, once the parsing has fully succeeded, and is otherwise left untouched */
+	inline arger::Parsed Parse(const std::vector<std::wstring>& args, const arger::CompiledConfig& config, auto& target) {
+		return detail::ParseViews<wchar_t>({ args.begin(), args.end() }, config, false, false, detail::MakeTarget(target));
+	}
+	inline arger::Parsed Parse(const std::vector<std::wstring>& args, const arger::Config& config, auto& target) {
+		return arger::Parse(args, arger::CompiledConfig{ config, false }, target);
+	}
+	inline arger::Parsed Parse(std::vector<std::wstring>&& args, const arger::CompiledConfig& config, auto& target) {
+		return detail::ParseOwned(std::move(args), config, false, detail::MakeTarget(target));
+	}
+	inline arger::Parsed Parse(std::vector<std::wstring>&& args, const arger::Config& config, auto& target) {
+		return arger::Parse(std::move(args), arger::CompiledConfig{ config, false }, target);
+	}
+
+	/* parse the arguments as menu-input arguments, and write the values of all bound options/positionals into the target (see arger::Bind) */
+	inline arger::Parsed Menu(const std::vector<std::wstring>& args, const arger::CompiledConfig& config, auto& target) {
+		return detail::ParseViews<wchar_t>({ args.begin(), args.end() }, config, true, false, detail::MakeTarget(target));
+	}
+	inline arger::Parsed Menu(const std::vector<std::wstring>& args, const arger::Config& config, auto& target) {
+		return arger::Menu(args, arger::CompiledConfig{ config, true }, target);
+	}
+	inline arger::Parsed Menu(std::vector<std::wstring>&& args, const arger::CompiledConfig& config, auto& target) {
+		return detail::ParseOwned(std::move(args), config, true, detail::MakeTarget(target));
+	}
+	inline arger::Parsed Menu(std::vector<std::wstring>&& args, const arger::Config& config, auto& target) {
+		return arger::Menu(std::move(args), arger::CompiledConfig{ config, true }, target);
+	}
+
+	/* parse the arguments as standard program arguments, but only reference the argument strings within the parsed values, instead
+	*	of copying them (arguments are only decoded when accessed as strings and must therefore outlive the parsed structure,
+	*	which is why temporary arguments are rejected) */
+	inline arger::Parsed ParseBorrowed(const std::vector<std::wstring>& args, const arger::CompiledConfig& config) {
+		return detail::ParseViews<wchar_t>({ args.begin(), args.end() }, config, false, true);
+	}
+	inline arger::Parsed ParseBorrowed(const std::vector<std::wstring>& args, const arger::Config& config) {
+		return arger::ParseBorrowed(args, arger::CompiledConfig{ config, false });
+	}
+	arger::Parsed ParseBorrowed(std::vector<std::wstring>&& args, const arger::CompiledConfig& config) = delete;
+	arger::Parsed ParseBorrowed(std::vector<std::wstring>&& args, const arger::Config& config) = delete;
+
+	/* parse the arguments as menu-input arguments, but only reference the argument strings (see arger::ParseBorrowed) */
+	inline arger::Parsed MenuBorrowed(const std::vector<std::wstring>& args, const arger::CompiledConfig& config) {
+		return detail::ParseViews<wchar_t>({ args.begin(), args.end() }, config, true, true);
+	}
+	inline arger::Parsed MenuBorrowed(const std::vector<std::wstring>& args, const arger::Config& config) {
+		return arger::MenuBorrowed(args, arger::CompiledConfig{ config, true });
 	}
+	arger::Parsed MenuBorrowed(std::vector<std::wstring>&& args, const arger::CompiledConfig& config) = delete;
+	arger::Parsed MenuBorrowed(std::vector<std::wstring>&& args, const arger::Config& config) = delete;
 }
@@ -0,0 +1,185 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2024 Bjoern Boss Henrichsen */
+#pragma once
+
+#include "arger-common.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
+
+namespace arger {
+	namespace detail {
+		/* characters, which require special treatment when splitting a line into arguments (whitespace, quotes, escapes,
+		*	and all non-ascii characters, as they might be whitespace as well, depending on the current locale) */
+		template <class ChType>
+		constexpr bool IsTokenSpecial(ChType c) {
+			std::make_unsigned_t<ChType> v = std::make_unsigned_t<ChType>(c);
+			return (v <= 0x20 || v >= 0x80 || v == u'\"' || v == u'\'' || v == u'\\');
+		}
+
+#if defined(__AVX2__)
+		/* compute the mask of all special characters (signed comparison covers all characters larger than the signed maximum) */
+		template <size_t Width>
+		inline __m256i TokenMaskAVX2(__m256i v) {
+			if constexpr (Width == 1)
+				return _mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(0x21), v), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\"'))),
+					_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\'')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'))));
+			else if constexpr (Width == 2)
+				return _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi16(_mm256_set1_epi16(0x21), v), _mm256_cmpgt_epi16(v, _mm256_set1_epi16(0x7f))),
+					_mm256_cmpeq_epi16(v, _mm256_set1_epi16('\"'))), _mm256_or_si256(_mm256_cmpeq_epi16(v, _mm256_set1_epi16('\'')), _mm256_cmpeq_epi16(v, _mm256_set1_epi16('\\'))));
+			else
+				return _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi32(_mm256_set1_epi32(0x21), v), _mm256_cmpgt_epi32(v, _mm256_set1_epi32(0x7f))),
+					_mm256_cmpeq_epi32(v, _mm256_set1_epi32('\"'))), _mm256_or_si256(_mm256_cmpeq_epi32(v, _mm256_set1_epi32('\'')), _mm256_cmpeq_epi32(v, _mm256_set1_epi32('\\'))));
+		}
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		template <size_t Width>
+		inline __m128i TokenMaskSSE2(__m128i v) {
+			if constexpr (Width == 1)
+				return _mm_or_si128(_mm_or_si128(_mm_cmplt_epi8(v, _mm_set1_epi8(0x21)), _mm_cmpeq_epi8(v, _mm_set1_epi8('\"'))),
+					_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\'')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))));
+			else if constexpr (Width == 2)
+				return _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_cmplt_epi16(v, _mm_set1_epi16(0x21)), _mm_cmpgt_epi16(v, _mm_set1_epi16(0x7f))),
+					_mm_cmpeq_epi16(v, _mm_set1_epi16('\"'))), _mm_or_si128(_mm_cmpeq_epi16(v, _mm_set1_epi16('\'')), _mm_cmpeq_epi16(v, _mm_set1_epi16('\\'))));
+			else
+				return _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_cmplt_epi32(v, _mm_set1_epi32(0x21)), _mm_cmpgt_epi32(v, _mm_set1_epi32(0x7f))),
+					_mm_cmpeq_epi32(v, _mm_set1_epi32('\"'))), _mm_or_si128(_mm_cmpeq_epi32(v, _mm_set1_epi32('\'')), _mm_cmpeq_epi32(v, _mm_set1_epi32('\\'))));
+		}
+#endif
+
+		/* find the index of the next special character starting at the offset (or the size, if none exists) */
+		template <class ChType>
+		inline size_t FindTokenSpecial(const ChType* data, size_t size, size_t offset) {
+			constexpr size_t Width = sizeof(ChType);
+
+#if defined(__AVX2__)
+			for (; offset + 32 / Width <= size; offset += 32 / Width) {
+				__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset));
+				uint32_t mask = uint32_t(_mm256_movemask_epi8(detail::TokenMaskAVX2<Width>(v)));
+				if (mask != 0)
+					return offset + size_t(std::countr_zero(mask)) / Width;
+			}
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+			for (; offset + 16 / Width <= size; offset += 16 / Width) {
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+				uint32_t mask = uint32_t(_mm_movemask_epi8(detail::TokenMaskSSE2<Width>(v)));
+				if (mask != 0)
+					return offset + size_t(std::countr_zero(mask)) / Width;
+			}
+#endif
+
+			/* process the remaining characters (or all characters, if no vector instructions are available) */
+			while (offset < size && !detail::IsTokenSpecial(data[offset]))
+				++offset;
+			return offset;
+		}
+
+		/* find the index of the next separator starting at the offset (or the size, if none exists), which must be an ascii
+		*	character, as it can then be compared per code-unit, without having to decode the encoding of the characters */
+		template <class ChType>
+		inline size_t FindSeparator(const ChType* data, size_t size, size_t offset, wchar_t separator) {
+			constexpr size_t Width = sizeof(ChType);
+
+#if defined(__AVX2__)
+			__m256i sep256 = (Width == 1 ? _mm256_set1_epi8(char(separator)) : (Width == 2 ? _mm256_set1_epi16(short(separator)) : _mm256_set1_epi32(int(separator))));
+			for (; offset + 32 / Width <= size; offset += 32 / Width) {
+				__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + offset));
+				__m256i eq = (Width == 1 ? _mm256_cmpeq_epi8(v, sep256) : (Width == 2 ? _mm256_cmpeq_epi16(v, sep256) : _mm256_cmpeq_epi32(v, sep256)));
+				uint32_t mask = uint32_t(_mm256_movemask_epi8(eq));
+				if (mask != 0)
+					return offset + size_t(std::countr_zero(mask)) / Width;
+			}
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+			__m128i sep128 = (Width == 1 ? _mm_set1_epi8(char(separator)) : (Width == 2 ? _mm_set1_epi16(short(separator)) : _mm_set1_epi32(int(separator))));
+			for (; offset + 16 / Width <= size; offset += 16 / Width) {
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+				__m128i eq = (Width == 1 ? _mm_cmpeq_epi8(v, sep128) : (Width == 2 ? _mm_cmpeq_epi16(v, sep128) : _mm_cmpeq_epi32(v, sep128)));
+				uint32_t mask = uint32_t(_mm_movemask_epi8(eq));
+				if (mask != 0)
+					return offset + size_t(std::countr_zero(mask)) / Width;
+			}
+#endif
+
+			/* process the remaining characters (or all characters, if no vector instructions are available) */
+			while (offset < size && std::make_unsigned_t<ChType>(data[offset]) != std::make_unsigned_t<ChType>(separator))
+				++offset;
+			return offset;
+		}
+
+		/* decode the utf-8 encoded argument into the output, which must provide space for at least as many characters as the input has bytes,
+		*	and return the number of written characters (pure ascii blocks are widened directly, and malformed input results in an exception) */
+		inline size_t DecodeUtf8(const uint8_t* in, size_t size, wchar_t* out, size_t index) {
+			size_t i = 0, written = 0;
+			while (i < size) {
+#if defined(__AVX2__)
+				for (; i + 32 <= size; i += 32, written += 32) {
+					__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+					if (_mm256_movemask_epi8(v) != 0)
+						break;
+					for (size_t j = 0; j < 32; j += 32 / sizeof(wchar_t)) {
+						if constexpr (sizeof(wchar_t) == 2)
+							_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + written + j), _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + j))));
+						else
+							_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + written + j), _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i + j))));
+					}
+				}
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+				for (; i + 16 <= size; i += 16, written += 16) {
+					__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+					if (_mm_movemask_epi8(v) != 0)
+						break;
+					__m128i zero = _mm_setzero_si128(), low = _mm_unpacklo_epi8(v, zero), high = _mm_unpackhi_epi8(v, zero);
+					if constexpr (sizeof(wchar_t) == 2) {
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(out + written), low);
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(out + written + 8), high);
+					}
+					else {
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(out + written), _mm_unpacklo_epi16(low, zero));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(out + written + 4), _mm_unpackhi_epi16(low, zero));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(out + written + 8), _mm_unpacklo_epi16(high, zero));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(out + written + 12), _mm_unpackhi_epi16(high, zero));
+					}
+				}
+#endif
+				if (i >= size)
+					break;
+
+				/* decode the next codepoint (ascii characters are copied until the next vectorized block can be processed) */
+				uint8_t c = in[i];
+				if (c < 0x80) {
+					out[written++] = wchar_t(c);
+					++i;
+					continue;
+				}
+				size_t count = (c >= 0xf0 ? 3 : (c >= 0xe0 ? 2 : 1));
+				uint32_t cp = (c & (0x3f >> count));
+				bool valid = (c >= 0xc2 && c <= 0xf4 && i + count < size);
+				for (size_t j = 1; valid && j <= count; ++j) {
+					valid = ((in[i + j] & 0xc0) == 0x80);
+					cp = (cp << 6) | (in[i + j] & 0x3f);
+				}
+
+				/* reject truncated and overlong encodings, surrogates, and out-of-range codepoints */
+				if (!valid || (count == 2 && cp < 0x800) || (count == 3 && cp < 0x10000) || cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff))
+					throw arger::ParsingException{ L"Argument [", index, L"] contains malformed UTF-8 at byte [", i, L"]." };
+				i += count + 1;
+
+				/* write the codepoint out (as surrogate-pair, if necessary) */
+				if (sizeof(wchar_t) == 2 && cp >= 0x10000) {
+					out[written++] = wchar_t(0xd800 + ((cp - 0x10000) >> 10));
+					out[written++] = wchar_t(0xdc00 + ((cp - 0x10000) & 0x03ff));
+				}
+				else
+					out[written++] = wchar_t(cp);
+			}
+			return written;
+		}
+	}
+}
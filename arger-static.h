@@ -0,0 +1,602 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (c) 2024 Bjoern Boss Henrichsen */
+#pragma once
+
+#include "arger-common.h"
+#include "arger-config.h"
+#include "arger-parsed.h"
+#include "arger-verify.h"
+
+namespace arger {
+	namespace detail {
+		/* reference to a static array, which can be used within constant expressions (the type may still be incomplete when declaring the list) */
+		template <class Type>
+		struct StaticList {
+		public:
+			const Type* data = 0;
+			size_t size = 0;
+
+		public:
+			constexpr StaticList() = default;
+			template <size_t N>
+			constexpr StaticList(const Type(&array)[N]) : data{ array }, size{ N } {}
+
+		public:
+			constexpr const Type* begin() const {
+				return data;
+			}
+			constexpr const Type* end() const {
+				return data + size;
+			}
+			constexpr const Type& operator[](size_t index) const {
+				return data[index];
+			}
+			constexpr bool empty() const {
+				return (size == 0);
+			}
+		};
+
+		/* not constant-evaluable, and therefore fails the compilation, if reached during the static validation */
+		inline void StaticError(const wchar_t* message) {
+			throw arger::ConfigException{ message };
+		}
+	}
+
+	/* constant-evaluable default value of a static configuration */
+	struct StaticValue {
+	public:
+		std::variant<uint64_t, int64_t, double, bool, std::wstring_view> value;
+
+	public:
+		constexpr StaticValue(uint64_t v) : value{ v } {}
+		constexpr StaticValue(int64_t v) : value{ v } {
+			if (v >= 0)
+				value = uint64_t(v);
+		}
+		constexpr StaticValue(double v) : value{ v } {}
+		constexpr StaticValue(bool v) : value{ v } {}
+		constexpr StaticValue(std::wstring_view v) : value{ v } {}
+
+	public:
+		/* convenience */
+		constexpr StaticValue(int v) : StaticValue{ int64_t(v) } {}
+		constexpr StaticValue(const wchar_t* s) : value{ std::wstring_view{ s } } {}
+
+	public:
+		arger::Value toValue() const {
+			if (std::holds_alternative<uint64_t>(value))
+				return arger::Value{ std::get<uint64_t>(value) };
+			if (std::holds_alternative<int64_t>(value))
+				return arger::Value{ std::get<int64_t>(value) };
+			if (std::holds_alternative<double>(value))
+				return arger::Value{ std::get<double>(value) };
+			if (std::holds_alternative<bool>(value))
+				return arger::Value{ std::get<bool>(value) };
+			return arger::Value{ std::wstring{ std::get<std::wstring_view>(value) } };
+		}
+	};
+
+	/* single key and description of a static enum */
+	struct StaticEnum {
+		std::wstring_view name;
+		std::wstring_view description;
+	};
+
+	/* constant-evaluable type of a static configuration (enum, if enum-entries are referenced, otherwise primitive) */
+	struct StaticType {
+	public:
+		detail::StaticList<arger::StaticEnum> enumerate;
+		arger::Primitive primitive = arger::Primitive::any;
+
+	public:
+		constexpr StaticType(arger::Primitive primitive = arger::Primitive::any) : primitive{ primitive } {}
+		template <size_t N>
+		constexpr StaticType(const arger::StaticEnum(&enumerate)[N]) : enumerate{ enumerate } {}
+
+	public:
+		arger::Type toType() const {
+			if (enumerate.empty())
+				return primitive;
+			arger::Enum::Values out;
+			for (const auto& entry : enumerate)
+				out.insert({ std::wstring{ entry.name }, std::wstring{ entry.description } });
+			return arger::Enum{ std::move(out) };
+		}
+	};
+
+	/* static counterpart to arger::Help */
+	struct StaticHelp {
+		std::wstring_view name;
+		std::wstring_view text;
+	};
+
+	/* static counterpart to arger::Positional */
+	struct StaticPositional {
+		std::wstring_view name;
+		arger::StaticType type;
+		std::wstring_view description;
+		std::optional<arger::StaticValue> defValue;
+	};
+
+	/* static counterpart to arger::Option (a non-empty payload-name marks the option as carrying a payload) */
+	struct StaticOption {
+		std::wstring_view name;
+		std::wstring_view description;
+		wchar_t abbreviation = 0;
+		std::wstring_view payload;
+		arger::StaticType type;
+		detail::StaticList<arger::StaticValue> defValue;
+		std::optional<size_t> minimum;
+		std::optional<size_t> maximum;
+		bool flagHelp = false;
+		bool flagVersion = false;
+	};
+
+	/* static counterpart to arger::Group */
+	struct StaticGroup {
+		std::wstring_view name;
+		std::wstring_view id;
+		std::wstring_view description;
+		detail::StaticList<arger::StaticGroup> groups;
+		std::wstring_view groupName;
+		detail::StaticList<arger::StaticPositional> positionals;
+		std::optional<size_t> minimum;
+		std::optional<size_t> maximum;
+		detail::StaticList<std::wstring_view> use;
+		detail::StaticList<arger::StaticHelp> help;
+		bool flagHelp = false;
+		bool flagVersion = false;
+	};
+
+	/* static counterpart to arger::Config, which can be declared as constexpr table and validated at compile-time
+	*	Note: Constraints cannot be expressed statically and must be added to the built arger::Config */
+	struct StaticConfig {
+		std::wstring_view program;
+		std::wstring_view version;
+		std::wstring_view description;
+		detail::StaticList<arger::StaticOption> options;
+		detail::StaticList<arger::StaticGroup> groups;
+		std::wstring_view groupName;
+		detail::StaticList<arger::StaticPositional> positionals;
+		std::optional<size_t> minimum;
+		std::optional<size_t> maximum;
+		detail::StaticList<arger::StaticHelp> help;
+	};
+
+	namespace detail {
+		consteval void StaticValidateHelp(const detail::StaticList<arger::StaticHelp>& help) {
+			for (const auto& entry : help) {
+				if (entry.name.empty() || entry.text.empty())
+					detail::StaticError(L"Help name and help description must not be empty.");
+			}
+		}
+		consteval void StaticValidateDefValue(const arger::StaticType& type, const arger::StaticValue& value) {
+			/* check if the value must be an enum */
+			if (!type.enumerate.empty()) {
+				if (std::holds_alternative<std::wstring_view>(value.value)) {
+					for (const auto& entry : type.enumerate) {
+						if (entry.name == std::get<std::wstring_view>(value.value))
+							return;
+					}
+				}
+				detail::StaticError(L"Default value must be a valid enum for the given type.");
+			}
+
+			/* validate the expected default type (mirrors the implicit conversions of arger::Value) */
+			bool isUNum = std::holds_alternative<uint64_t>(value.value);
+			bool isINum = (isUNum || std::holds_alternative<int64_t>(value.value));
+			switch (type.primitive) {
+			case arger::Primitive::boolean:
+				if (!std::holds_alternative<bool>(value.value))
+					detail::StaticError(L"Default value is expected to be a boolean.");
+				break;
+			case arger::Primitive::real:
+				if (!isINum && !std::holds_alternative<double>(value.value))
+					detail::StaticError(L"Default value is expected to be a real.");
+				break;
+			case arger::Primitive::inum:
+				if (!isINum)
+					detail::StaticError(L"Default value is expected to be a signed integer.");
+				break;
+			case arger::Primitive::unum:
+				if (!isUNum)
+					detail::StaticError(L"Default value is expected to be an unsigned integer.");
+				break;
+			case arger::Primitive::any:
+				break;
+			}
+		}
+		consteval void StaticValidateFlags(const arger::StaticConfig& config, bool flagHelp, bool flagVersion, bool payload) {
+			if (flagHelp && flagVersion)
+				detail::StaticError(L"Object cannot be help and version special purpose at once.");
+			if (flagVersion && config.version.empty())
+				detail::StaticError(L"Object cannot be a version special purpose flag if no version has been set.");
+			if ((flagHelp || flagVersion) && payload)
+				detail::StaticError(L"Object cannot be a special purpose flag and carry a payload/require arguments.");
+		}
+		consteval void StaticValidateOption(const arger::StaticConfig& config, size_t index) {
+			const arger::StaticOption& option = config.options[index];
+			if (option.name.empty())
+				detail::StaticError(L"Option name must not be empty.");
+			if (option.name.starts_with(L"-"))
+				detail::StaticError(L"Option name must not start with a hypen.");
+
+			/* check if the name and abbreviation are unique */
+			for (size_t i = 0; i < index; ++i) {
+				if (config.options[i].name == option.name)
+					detail::StaticError(L"Option with the same name already exists.");
+				if (option.abbreviation != 0 && config.options[i].abbreviation == option.abbreviation)
+					detail::StaticError(L"Option abbreviation already exists.");
+			}
+
+			/* validate the special-purpose attributes */
+			bool payload = !option.payload.empty();
+			detail::StaticValidateFlags(config, option.flagHelp, option.flagVersion, payload);
+
+			/* configure the limits */
+			size_t minimum = option.minimum.value_or(0), maximum = std::max<size_t>(minimum, 1);
+			if (option.maximum.has_value())
+				maximum = (*option.maximum == 0 ? 0 : std::max<size_t>(minimum, *option.maximum));
+
+			/* validate the default-values */
+			if (!payload || option.defValue.empty())
+				return;
+			if (option.defValue.size < minimum)
+				detail::StaticError(L"Default values for option must not violate its own minimum requirements.");
+			if (maximum > 0 && option.defValue.size > maximum)
+				detail::StaticError(L"Default values for option must not violate its own maximum requirements.");
+			for (const auto& value : option.defValue)
+				detail::StaticValidateDefValue(option.type, value);
+		}
+		consteval size_t StaticCountIds(const detail::StaticList<arger::StaticGroup>& groups, const std::wstring_view& id) {
+			size_t count = 0;
+			for (const auto& group : groups) {
+				if (!group.groups.empty())
+					count += detail::StaticCountIds(group.groups, id);
+				else if ((group.id.empty() ? group.name : group.id) == id)
+					++count;
+			}
+			return count;
+		}
+		consteval bool StaticUsesOption(const arger::StaticConfig& config, const std::wstring_view& name) {
+			for (const auto& option : config.options) {
+				if (option.name == name)
+					return true;
+			}
+			return false;
+		}
+		consteval void StaticValidateArguments(const arger::StaticConfig& config, const detail::StaticList<arger::StaticGroup>& groups, const detail::StaticList<arger::StaticPositional>& positionals, bool root) {
+			if (!groups.empty() && !positionals.empty())
+				detail::StaticError(L"Arguments/groups cannot have positional arguments and sub-groups.");
+
+			/* validate the positionals */
+			for (const auto& positional : positionals) {
+				if (positional.name.empty())
+					detail::StaticError(L"Positional argument must not have an empty name.");
+				if (positional.defValue.has_value())
+					detail::StaticValidateDefValue(positional.type, *positional.defValue);
+			}
+
+			/* validate the groups */
+			for (size_t i = 0; i < groups.size; ++i) {
+				const arger::StaticGroup& group = groups[i];
+				if (group.name.empty())
+					detail::StaticError(L"Group name must not be empty.");
+				if (group.name.starts_with(L"-"))
+					detail::StaticError(L"Group name must not start with a hypen.");
+				for (size_t j = 0; j < i; ++j) {
+					if (groups[j].name == group.name)
+						detail::StaticError(L"Group with the same name already exists for given groups-set.");
+				}
+
+				/* validate the special-purpose attributes */
+				if (group.flagHelp || group.flagVersion) {
+					detail::StaticValidateFlags(config, group.flagHelp, group.flagVersion, !group.positionals.empty() || !group.groups.empty());
+					if (!root)
+						detail::StaticError(L"Group can only have a help special purpose flag assigned if its a root group.");
+				}
+
+				/* validate the group-id uniqueness (only necessary if it does not contain sub-groups itself) */
+				if (group.groups.empty() && detail::StaticCountIds(config.groups, group.id.empty() ? group.name : group.id) > 1)
+					detail::StaticError(L"Group with the same id already exists.");
+
+				/* validate the usages and help attributes */
+				for (const auto& use : group.use) {
+					if (!detail::StaticUsesOption(config, use))
+						detail::StaticError(L"Group uses undefined option.");
+				}
+				detail::StaticValidateHelp(group.help);
+				detail::StaticValidateArguments(config, group.groups, group.positionals, false);
+			}
+		}
+	}
+
+	/* validate the static configuration at compile-time, which fails the compilation for a
+	*	malformed configuration, and otherwise returns true (to be used with static_assert) */
+	consteval bool StaticValidate(const arger::StaticConfig& config, bool menu) {
+		if (menu && !config.program.empty())
+			detail::StaticError(L"Menu cannot have a program name.");
+		if (!menu && config.program.empty())
+			detail::StaticError(L"Configuration must have a program name.");
+
+		detail::StaticValidateHelp(config.help);
+		for (size_t i = 0; i < config.options.size; ++i)
+			detail::StaticValidateOption(config, i);
+		detail::StaticValidateArguments(config, config.groups, config.positionals, true);
+		return true;
+	}
+
+	namespace detail {
+		inline void StaticBuildHelp(detail::Help& out, const detail::StaticList<arger::StaticHelp>& help) {
+			for (const auto& entry : help)
+				out.help.push_back({ std::wstring{ entry.name }, std::wstring{ entry.text } });
+		}
+		inline void StaticBuildArguments(detail::Arguments& out, const detail::StaticList<arger::StaticGroup>& groups, std::wstring_view groupName, const detail::StaticList<arger::StaticPositional>& positionals, std::optional<size_t> minimum, std::optional<size_t> maximum) {
+			out.require.minimum = minimum;
+			out.require.maximum = maximum;
+			out.groups.name = groupName;
+			for (const auto& positional : positionals) {
+				std::optional<arger::Value> defValue;
+				if (positional.defValue.has_value())
+					defValue = positional.defValue->toValue();
+				out.positionals.push_back({ std::move(defValue), std::wstring{ positional.name }, positional.type.toType(), std::wstring{ positional.description }, {} });
+			}
+
+			for (const auto& group : groups) {
+				arger::Group& entry = out.groups.list.emplace_back(std::wstring{ group.name }, std::wstring{ group.id });
+				entry.description = group.description;
+				entry.flagHelp = group.flagHelp;
+				entry.flagVersion = group.flagVersion;
+				for (const auto& use : group.use)
+					entry.use.insert(std::wstring{ use });
+				detail::StaticBuildHelp(entry, group.help);
+				detail::StaticBuildArguments(entry, group.groups, group.groupName, group.positionals, group.minimum, group.maximum);
+			}
+		}
+	}
+
+	/* construct the runtime configuration for the static configuration (the configuration is
+	*	only built, when invoked, and therefore does not require any dynamic initialization) */
+	inline arger::Config StaticBuild(const arger::StaticConfig& config) {
+		arger::Config out;
+		out.program = config.program;
+		out.version = config.version;
+		out.description = config.description;
+		detail::StaticBuildHelp(out, config.help);
+
+		for (const auto& option : config.options) {
+			arger::Option& entry = out.options.emplace_back(std::wstring{ option.name });
+			entry.description = option.description;
+			entry.abbreviation = option.abbreviation;
+			entry.require.minimum = option.minimum;
+			entry.require.maximum = option.maximum;
+			entry.flagHelp = option.flagHelp;
+			entry.flagVersion = option.flagVersion;
+			if (option.payload.empty())
+				continue;
+			entry.payload.name = option.payload;
+			entry.payload.type = option.type.toType();
+			for (const auto& value : option.defValue)
+				entry.payload.defValue.push_back(value.toValue());
+		}
+
+		detail::StaticBuildArguments(out, config.groups, config.groupName, config.positionals, config.minimum, config.maximum);
+		return out;
+	}
+
+	namespace detail {
+		inline arger::Config StaticBuildConstrained(const arger::StaticConfig& config, std::vector<arger::Checker>&& constraints) {
+			arger::Config out = arger::StaticBuild(config);
+			out.constraints = std::move(constraints);
+			return out;
+		}
+	}
+
+	/* compiled configuration of the static configuration, which owns the built configuration, and which is validated by arger::StaticValidate
+	*	at compile-time, and is therefore only laid out at runtime, without being validated again (constraints are added to the root arguments)
+	*	Note: Can be passed to the parsing functions via arger::StaticCompiled::compiled */
+	template <const arger::StaticConfig& Config, bool Menu = false>
+	class StaticCompiled {
+		static_assert(arger::StaticValidate(Config, Menu), "Static configuration is malformed");
+	private:
+		arger::Config pConfig;
+		arger::CompiledConfig pCompiled;
+
+	public:
+		StaticCompiled(std::vector<arger::Checker> constraints = {}) : pConfig{ detail::StaticBuildConstrained(Config, std::move(constraints)) }, pCompiled{ pConfig, Menu, false, true } {}
+		StaticCompiled(arger::StaticCompiled<Config, Menu>&&) = delete;
+		StaticCompiled(const arger::StaticCompiled<Config, Menu>&) = delete;
+		arger::StaticCompiled<Config, Menu>& operator=(arger::StaticCompiled<Config, Menu>&&) = delete;
+		arger::StaticCompiled<Config, Menu>& operator=(const arger::StaticCompiled<Config, Menu>&) = delete;
+
+	public:
+		constexpr const arger::CompiledConfig& compiled() const {
+			return pCompiled;
+		}
+		constexpr const arger::Config& config() const {
+			return pConfig;
+		}
+	};
+
+	/* name of an option, which can be passed as template argument (narrow names must be ascii, and otherwise fail the compilation) */
+	template <size_t N>
+	struct FixedName {
+	public:
+		wchar_t value[N] = {};
+
+	public:
+		consteval FixedName(const char(&name)[N]) {
+			for (size_t i = 0; i < N; ++i) {
+				if (static_cast<unsigned char>(name[i]) >= 0x80)
+					detail::StaticError(L"Narrow option names must only consist of ascii characters.");
+				value[i] = wchar_t(name[i]);
+			}
+		}
+		constexpr FixedName(const wchar_t(&name)[N]) {
+			for (size_t i = 0; i < N; ++i)
+				value[i] = name[i];
+		}
+
+	public:
+		constexpr std::wstring_view view() const {
+			return std::wstring_view{ value, N - 1 };
+		}
+	};
+
+	namespace detail {
+		consteval size_t StaticFindOption(const arger::StaticConfig& config, const std::wstring_view& name) {
+			for (size_t i = 0; i < config.options.size; ++i) {
+				if (config.options[i].name == name)
+					return i;
+			}
+			return detail::NoName;
+		}
+
+		/* dense id of the option (matches the id of the compiled configuration, as its options are sorted by name as well) */
+		consteval size_t StaticOptionId(const arger::StaticConfig& config, size_t index) {
+			if (index >= config.options.size)
+				return detail::NoName;
+			size_t id = 0;
+			for (const auto& option : config.options) {
+				if (option.name < config.options[index].name)
+					++id;
+			}
+			return id;
+		}
+		consteval bool StaticRestricted(const detail::StaticList<arger::StaticGroup>& groups, const std::wstring_view& name) {
+			for (const auto& group : groups) {
+				for (const auto& use : group.use) {
+					if (use == name)
+						return true;
+				}
+				if (detail::StaticRestricted(group.groups, name))
+					return true;
+			}
+			return false;
+		}
+
+		consteval bool StaticHasPayload(const arger::StaticConfig& config, size_t index) {
+			return (index < config.options.size && !config.options[index].payload.empty());
+		}
+
+		/* check if at least one value of the option will exist after a successful parse (required or defaulted, and not restricted to certain groups) */
+		consteval bool StaticGuaranteed(const arger::StaticConfig& config, size_t index) {
+			if (!detail::StaticHasPayload(config, index))
+				return false;
+			const arger::StaticOption& option = config.options[index];
+			if (detail::StaticRestricted(config.groups, option.name))
+				return false;
+			return (option.minimum.value_or(0) > 0 || !option.defValue.empty());
+		}
+
+		/* native type of the payload of the option (enums are accessed as strings, and unknown options resolve to any,
+		*	in order for only the corresponding static assertion to fail, instead of the resolution of the type) */
+		consteval arger::Primitive StaticPrimitive(const arger::StaticConfig& config, size_t index) {
+			if (index >= config.options.size || !config.options[index].type.enumerate.empty())
+				return arger::Primitive::any;
+			return config.options[index].type.primitive;
+		}
+		template <arger::Primitive Primitive>
+		using StaticNative = std::conditional_t<Primitive == arger::Primitive::unum, uint64_t,
+			std::conditional_t<Primitive == arger::Primitive::inum, int64_t,
+			std::conditional_t<Primitive == arger::Primitive::real, double,
+			std::conditional_t<Primitive == arger::Primitive::boolean, bool, std::wstring>>>>;
+	}
+
+	/* typed view on the parsed results of a static configuration, whose option names are resolved to their dense ids and
+	*	checked against their payload types at compile-time (parsed results must originate from arger::StaticBuild(Config))
+	*	Note: Accessing an unknown option, a flag as payload, or a payload as a different type, fails the compilation */
+	template <const arger::StaticConfig& Config>
+	class StaticParsed {
+	private:
+		template <arger::FixedName Name>
+		static constexpr size_t Index = detail::StaticFindOption(Config, Name.view());
+		template <arger::FixedName Name>
+		static constexpr arger::OptionId Id{ detail::StaticOptionId(Config, Index<Name>) };
+		template <arger::FixedName Name>
+		static constexpr bool Payload = detail::StaticHasPayload(Config, Index<Name>);
+		template <arger::FixedName Name>
+		using Native = detail::StaticNative<detail::StaticPrimitive(Config, Index<Name>)>;
+
+	private:
+		arger::Parsed pParsed;
+
+	public:
+		StaticParsed(arger::Parsed&& parsed) : pParsed{ std::move(parsed) } {
+			/* ensure that the dense ids of the parsed results match the static configuration */
+			size_t count = (pParsed.pIds == 0 ? 0 : pParsed.pIds->names.size());
+			if (count != Config.options.size)
+				throw arger::ConfigException{ L"Parsed results do not originate from the static configuration." };
+			for (const auto& option : Config.options) {
+				size_t id = pParsed.pIds->table.find(option.name);
+				if (id == detail::NoName || pParsed.pIds->names[id] != option.name)
+					throw arger::ConfigException{ L"Parsed results do not originate from the static configuration." };
+			}
+		}
+
+	private:
+		template <class Type>
+		static constexpr decltype(auto) fRead(const arger::Value& value) {
+			if constexpr (std::is_same_v<Type, uint64_t>)
+				return value.unum();
+			else if constexpr (std::is_same_v<Type, int64_t>)
+				return value.inum();
+			else if constexpr (std::is_same_v<Type, double>)
+				return value.real();
+			else if constexpr (std::is_same_v<Type, bool>)
+				return value.boolean();
+			else
+				return value.str();
+		}
+
+	public:
+		constexpr const arger::Parsed& parsed() const {
+			return pParsed;
+		}
+		constexpr const std::wstring& groupId() const {
+			return pParsed.groupId();
+		}
+
+	public:
+		/* check if the flag has been set or if the payload has any values */
+		template <arger::FixedName Name>
+		constexpr bool has() const {
+			static_assert(Index<Name> != detail::NoName, "Unknown option name");
+			if constexpr (Payload<Name>)
+				return (pParsed.options(Id<Name>) > 0);
+			else
+				return pParsed.flag(Id<Name>);
+		}
+
+		/* number of values of the payload */
+		template <arger::FixedName Name>
+		constexpr size_t count() const {
+			static_assert(Index<Name> != detail::NoName, "Unknown option name");
+			static_assert(Index<Name> == detail::NoName || Payload<Name>, "Option is a flag and does not carry a payload");
+			return pParsed.options(Id<Name>);
+		}
+
+		/* first value of the payload (optional, if the payload is not guaranteed to have a value) */
+		template <arger::FixedName Name, class Type = Native<Name>>
+		constexpr decltype(auto) get() const {
+			static_assert(Index<Name> != detail::NoName, "Unknown option name");
+			static_assert(Index<Name> == detail::NoName || Payload<Name>, "Option is a flag and does not carry a payload");
+			static_assert(std::is_same_v<Type, Native<Name>>, "Requested type does not match the payload type");
+			if constexpr (detail::StaticGuaranteed(Config, Index<Name>))
+				return fRead<Type>(pParsed.pValues[pParsed.pOffsets[Id<Name>.index]]);
+			else
+				return get<Name, Type>(0);
+		}
+
+		/* value of the payload at the given index (empty, if out of range) */
+		template <arger::FixedName Name, class Type = Native<Name>>
+		constexpr std::optional<Type> get(size_t index) const {
+			static_assert(Index<Name> != detail::NoName, "Unknown option name");
+			static_assert(Index<Name> == detail::NoName || Payload<Name>, "Option is a flag and does not carry a payload");
+			static_assert(std::is_same_v<Type, Native<Name>>, "Requested type does not match the payload type");
+			if (index >= pParsed.options(Id<Name>))
+				return {};
+			return fRead<Type>(pParsed.pValues[pParsed.pOffsets[Id<Name>.index] + index]);
+		}
+	};
+}
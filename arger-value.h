@@ -3,12 +3,65 @@
 #pragma once
 
 #include "arger-common.h"
+#include "arger-enum.h"
 
 namespace arger {
-	/* representation of a single argument value (performs primitive type-conversions when accessing values) */
-	struct Value : private std::variant<uint64_t, int64_t, double, bool, std::wstring> {
+	namespace detail {
+		/* string borrowed from the original arguments, which is only decoded when first accessed as string
+		*	(the decoded string is cached within the value, and copies made after decoding share the cache)
+		*	Note: decoding modifies the cache of a const value, and is therefore not thread-safe */
+		struct BorrowedStr {
+			const void* data = 0;
+			size_t size = 0;
+			std::wstring(*decode)(const void*, size_t) = 0;
+			mutable std::shared_ptr<const std::wstring> decoded;
+		};
+
+		template <class ChType>
+		inline std::wstring DecodeBorrowed(const void* data, size_t size) {
+			std::basic_string_view<ChType> view{ static_cast<const ChType*>(data), size };
+			if constexpr (std::is_same_v<ChType, wchar_t>)
+				return std::wstring{ view };
+			else
+				return str::wd::To(view);
+		}
+
+		struct LazySource;
+
+		/* numeric argument, which is only converted to its type when first accessed (the converted number is cached, and
+		*	copies of the value share the cache, as the values only reference the lazy numbers within the shared source)
+		*	Note: converting modifies the cache of a const value, and is therefore not thread-safe */
+		struct LazyNum {
+			using Number = std::variant<std::monostate, uint64_t, int64_t, double>;
+			std::variant<std::wstring, detail::BorrowedStr> raw;
+			const detail::LazySource* source = 0;
+			mutable Number converted;
+
+			constexpr const Number& resolve() const;
+		};
+
+		/* all lazily converted values of a single argument, which are kept alive by any value referencing them */
+		struct LazySource {
+			std::wstring name;
+			arger::Primitive type = arger::Primitive::any;
+			void(*convert)(const detail::LazyNum&) = 0;
+			std::vector<detail::LazyNum> values;
+		};
+
+		constexpr const detail::LazyNum::Number& detail::LazyNum::resolve() const {
+			if (std::holds_alternative<std::monostate>(converted))
+				source->convert(*this);
+			return converted;
+		}
+	}
+
+	/* representation of a single argument value (performs primitive type-conversions when accessing values)
+	*	Note: Lazily converted values are converted on any access, and throw arger::ParsingException, if they are invalid */
+	struct Value : private std::variant<uint64_t, int64_t, double, bool, std::wstring, detail::BorrowedStr, std::shared_ptr<const detail::LazyNum>, detail::EnumRef> {
+		template <class ChType>
+		friend class detail::Parser;
 	private:
-		using Parent = std::variant<uint64_t, int64_t, double, bool, std::wstring>;
+		using Parent = std::variant<uint64_t, int64_t, double, bool, std::wstring, detail::BorrowedStr, std::shared_ptr<const detail::LazyNum>, detail::EnumRef>;
 
 	public:
 		Value() : Parent{ 0llu } {}
@@ -36,60 +89,117 @@ namespace arger {
 		}
 		constexpr Value(const wchar_t* s) : Parent{ std::wstring(s) } {}
 
+	private:
+		Value(detail::BorrowedStr&& v) : Parent{ std::move(v) } {}
+		Value(std::shared_ptr<const detail::LazyNum>&& v) : Parent{ std::move(v) } {}
+		Value(detail::EnumRef&& v) : Parent{ std::move(v) } {}
+
+	private:
+		constexpr const detail::BorrowedStr* fBorrowed() const {
+			return std::get_if<detail::BorrowedStr>(this);
+		}
+		template <class Type>
+		constexpr const Type* fGet() const {
+			/* lazy numbers are converted first, and can therefore only ever hold numbers */
+			if (const auto* lazy = std::get_if<std::shared_ptr<const detail::LazyNum>>(this); lazy != 0) {
+				const detail::LazyNum::Number& number = (*lazy)->resolve();
+				if constexpr (std::is_same_v<Type, uint64_t> || std::is_same_v<Type, int64_t> || std::is_same_v<Type, double>)
+					return std::get_if<Type>(&number);
+				else
+					return 0;
+			}
+			return std::get_if<Type>(this);
+		}
+
 	public:
 		constexpr bool isUNum() const {
-			return std::holds_alternative<uint64_t>(*this);
+			return (fGet<uint64_t>() != 0);
 		}
 		constexpr bool isINum() const {
-			if (std::holds_alternative<int64_t>(*this))
+			if (fGet<int64_t>() != 0)
 				return true;
-			return std::holds_alternative<uint64_t>(*this);
+			return (fGet<uint64_t>() != 0);
 		}
 		constexpr bool isReal() const {
-			if (std::holds_alternative<double>(*this))
+			if (fGet<double>() != 0)
 				return true;
-			if (std::holds_alternative<int64_t>(*this))
+			if (fGet<int64_t>() != 0)
 				return true;
-			return std::holds_alternative<uint64_t>(*this);
+			return (fGet<uint64_t>() != 0);
 		}
 		constexpr bool isBool() const {
-			return std::holds_alternative<bool>(*this);
+			return (fGet<bool>() != 0);
 		}
 		constexpr bool isStr() const {
-			return std::holds_alternative<std::wstring>(*this);
+			if (fGet<std::wstring>() != 0 || fGet<detail::EnumRef>() != 0)
+				return true;
+			return (fGet<detail::BorrowedStr>() != 0);
+		}
+		constexpr bool isEnum() const {
+			return (fGet<detail::EnumRef>() != 0);
 		}
 
 	public:
 		constexpr uint64_t unum() const {
-			if (std::holds_alternative<uint64_t>(*this))
-				return std::get<uint64_t>(*this);
+			if (const uint64_t* value = fGet<uint64_t>(); value != 0)
+				return *value;
 			throw arger::TypeException{ L"arger::Value is not an unsigned-number." };
 		}
 		constexpr int64_t inum() const {
-			if (std::holds_alternative<uint64_t>(*this))
-				return int64_t(std::get<uint64_t>(*this));
-			if (std::holds_alternative<int64_t>(*this))
-				return std::get<int64_t>(*this);
+			if (const uint64_t* value = fGet<uint64_t>(); value != 0)
+				return int64_t(*value);
+			if (const int64_t* value = fGet<int64_t>(); value != 0)
+				return *value;
 			throw arger::TypeException{ L"arger::Value is not a signed-number." };
 		}
 		constexpr double real() const {
-			if (std::holds_alternative<double>(*this))
-				return std::get<double>(*this);
-			if (std::holds_alternative<uint64_t>(*this))
-				return double(std::get<uint64_t>(*this));
-			if (std::holds_alternative<int64_t>(*this))
-				return double(std::get<int64_t>(*this));
+			if (const double* value = fGet<double>(); value != 0)
+				return *value;
+			if (const uint64_t* value = fGet<uint64_t>(); value != 0)
+				return double(*value);
+			if (const int64_t* value = fGet<int64_t>(); value != 0)
+				return double(*value);
 			throw arger::TypeException{ L"arger::Value is not a real." };
 		}
 		constexpr bool boolean() const {
-			if (std::holds_alternative<bool>(*this))
-				return std::get<bool>(*this);
+			if (const bool* value = fGet<bool>(); value != 0)
+				return *value;
 			throw arger::TypeException{ L"arger::Value is not a boolean." };
 		}
-		constexpr const std::wstring& str() const {
-			if (std::holds_alternative<std::wstring>(*this))
-				return std::get<std::wstring>(*this);
+		constexpr const std::wstring& str() const& {
+			if (const std::wstring* value = fGet<std::wstring>(); value != 0)
+				return *value;
+			if (const detail::EnumRef* value = fGet<detail::EnumRef>(); value != 0)
+				return *value->name;
+			if (const detail::BorrowedStr* borrowed = fGet<detail::BorrowedStr>(); borrowed != 0) {
+				if (borrowed->decoded == 0)
+					borrowed->decoded = std::make_shared<const std::wstring>(borrowed->decode(borrowed->data, borrowed->size));
+				return *borrowed->decoded;
+			}
 			throw arger::TypeException{ L"arger::Value is not a string." };
 		}
+		constexpr std::wstring_view view() const {
+			/* reference borrowed wide-character arguments directly, instead of decoding them */
+			if (const detail::BorrowedStr* borrowed = fGet<detail::BorrowedStr>(); borrowed != 0 && borrowed->decode == &detail::DecodeBorrowed<wchar_t>)
+				return std::wstring_view{ static_cast<const wchar_t*>(borrowed->data), borrowed->size };
+			return str();
+		}
+		constexpr size_t enumIndex() const {
+			/* index of the matched value within the sorted values of the enum */
+			if (const detail::EnumRef* value = fGet<detail::EnumRef>(); value != 0)
+				return value->index;
+			throw arger::TypeException{ L"arger::Value is not an enum." };
+		}
+		template <class Type>
+			requires std::is_enum_v<Type>
+		constexpr Type enumAs() const {
+			/* map the index to the user-enum, whose enumerators must be declared in the sorted order of the enum values */
+			return static_cast<Type>(enumIndex());
+		}
+		constexpr std::wstring str()&& {
+			if (std::holds_alternative<std::wstring>(*this))
+				return std::move(std::get<std::wstring>(*this));
+			return static_cast<const arger::Value&>(*this).str();
+		}
 	};
 }
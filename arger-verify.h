@@ -8,29 +8,55 @@
 namespace arger::detail {
 	struct ValidGroup;
 
+	/* number of directly indexed abbreviations (all others are looked up via the map) */
+	static constexpr size_t NumAsciiAbbreviations = 128;
+	static constexpr size_t NoAbbreviation = size_t(-1);
+
+	/* sorted option names and their lookup-table, which are shared with all parsed results, in order to map option names to
+	*	their dense ids (additionally contains the type of packed options, or arger::Primitive::any for all other options) */
+	struct OptionIds {
+		std::vector<std::wstring> names;
+		std::vector<arger::Primitive> packed;
+		detail::NameTable table;
+	};
+
 	struct ValidArguments {
 		const detail::Arguments* args = 0;
 		const detail::ValidArguments* super = 0;
-		std::map<std::wstring, detail::ValidGroup> sub;
+		std::span<detail::ValidGroup> sub;
+		detail::NameTable subNames;
 		std::wstring groupName;
+		size_t index = 0;
 		size_t minimum = 0;
 		size_t maximum = 0;
 		bool incomplete = false;
 		bool nestedPositionals = false;
+		bool validated = false;
 	};
 	struct ValidOption {
 		const arger::Option* option = 0;
-		std::set<const detail::ValidGroup*> users;
+		std::vector<bool> users;
 		size_t minimum = 0;
 		size_t maximum = 0;
 		bool payload = false;
 		bool restricted = false;
 	};
+
+	/* flat layout of the validated configuration
+	*	- options are sorted by name, and their index is used as dense id
+	*	- groups are stored contiguously, with all sub-groups of a group being adjacent and sorted by name
+	*	- option names and the group names of every level are resolved via collision-free name tables
+	*	- the dense group index is used to test group-membership in ValidOption::users (0 is the root) */
 	struct ValidConfig : public detail::ValidArguments {
-		std::map<std::wstring, detail::ValidOption> options;
-		std::map<wchar_t, detail::ValidOption*> abbreviations;
+		std::vector<detail::ValidOption> options;
+		std::shared_ptr<const detail::OptionIds> optionIds;
+		std::vector<detail::ValidGroup> groups;
+		std::array<size_t, detail::NumAsciiAbbreviations> asciiAbbreviations{};
+		std::map<wchar_t, size_t> abbreviations;
 		std::map<std::wstring, detail::ValidGroup*> groupIds;
 		const arger::Config* config = 0;
+		bool lazy = false;
+		bool trusted = false;
 	};
 	struct ValidGroup : public detail::ValidArguments {
 		const arger::Group* group = 0;
@@ -38,7 +64,41 @@ namespace arger::detail {
 		std::wstring_view id;
 	};
 
+	inline const detail::ValidOption* FindOption(const detail::ValidConfig& state, const std::wstring_view& name) {
+		size_t index = state.optionIds->table.find(name);
+		return (index == detail::NoName ? 0 : &state.options[index]);
+	}
+	template <class ChType>
+	inline const detail::ValidOption* FindOption(const detail::ValidConfig& state, const std::basic_string_view<ChType>& name) requires (!std::is_same_v<ChType, wchar_t>) {
+		size_t index = state.optionIds->table.findAscii(name);
+		return (index == detail::NoName ? 0 : &state.options[index]);
+	}
+	inline const detail::ValidOption* FindAbbreviation(const detail::ValidConfig& state, wchar_t abbreviation) {
+		size_t index = detail::NoAbbreviation;
+		if (size_t(abbreviation) < detail::NumAsciiAbbreviations)
+			index = state.asciiAbbreviations[size_t(abbreviation)];
+		else if (auto it = state.abbreviations.find(abbreviation); it != state.abbreviations.end())
+			index = it->second;
+		return (index == detail::NoAbbreviation ? 0 : &state.options[index]);
+	}
+	inline constexpr const detail::ValidGroup* FindGroup(const detail::ValidArguments& args, const std::wstring_view& name) {
+		size_t index = args.subNames.find(name);
+		return (index == detail::NoName ? 0 : &args.sub[index]);
+	}
+	template <class ChType>
+	inline constexpr const detail::ValidGroup* FindGroup(const detail::ValidArguments& args, const std::basic_string_view<ChType>& name) requires (!std::is_same_v<ChType, wchar_t>) {
+		size_t index = args.subNames.findAscii(name);
+		return (index == detail::NoName ? 0 : &args.sub[index]);
+	}
+	inline constexpr size_t CountGroups(const detail::Arguments& arguments) {
+		size_t count = arguments.groups.list.size();
+		for (const auto& sub : arguments.groups.list)
+			count += detail::CountGroups(sub);
+		return count;
+	}
+
 	inline void ValidateArguments(const arger::Config& config, const detail::Arguments& arguments, detail::ValidConfig& state, detail::ValidArguments& entry, detail::ValidGroup* self, detail::ValidArguments* super);
+	inline void ValidateDeferred(const arger::Config& config, detail::ValidArguments& entry, detail::ValidGroup* self, bool trusted);
 	inline constexpr void ValidateHelp(const detail::Help& help, const std::wstring& who) {
 		for (size_t i = 0; i < help.help.size(); ++i) {
 			if (help.help[i].name.empty() || help.help[i].text.empty())
@@ -53,7 +113,7 @@ namespace arger::detail {
 		/* check if the value must be an enum */
 		if (std::holds_alternative<arger::Enum>(type)) {
 			const arger::Enum& allowed = std::get<arger::Enum>(type);
-			if (value.isStr() && allowed.count(value.str()) != 0)
+			if (value.isStr() && (allowed.provider() != 0 || allowed.count(value.str()) != 0))
 				return;
 			throw arger::ConfigException{ L"Default value of ", who, L" must be a valid enum for the given type." };
 		}
@@ -89,26 +149,49 @@ namespace arger::detail {
 			throw arger::ConfigException{ who, L" cannot be a special purpose flag and carry a payload/require arguments." };
 
 	}
-	inline void ValidateOption(const arger::Config& config, const arger::Option& option, detail::ValidConfig& state) {
-		if (option.name.empty())
-			throw arger::ConfigException{ L"Option name must not be empty." };
-		if (option.name.starts_with(L"-"))
-			throw arger::ConfigException{ L"Option name must not start with a hypen." };
-
-		/* check if the name is unique */
-		if (state.options.contains(option.name))
-			throw arger::ConfigException{ L"Option with name [", option.name, L"] already exists." };
-		detail::ValidOption& entry = state.options[option.name];
-		entry.option = &option;
+	inline constexpr bool IsNumeric(const arger::Type& type) {
+		if (!std::holds_alternative<arger::Primitive>(type))
+			return false;
+		arger::Primitive primitive = std::get<arger::Primitive>(type);
+		return (primitive == arger::Primitive::unum || primitive == arger::Primitive::inum || primitive == arger::Primitive::real);
+	}
+	inline void ValidateBinding(const detail::Binding& binding, const arger::Type* type, bool multiple, const std::wstring& who) {
+		if (!binding.convert)
+			return;
+		if (!binding.accepts(type))
+			throw arger::ConfigException{ L"Bound member of ", who, L" does not match its type." };
+		if (multiple && !binding.multiple)
+			throw arger::ConfigException{ L"Bound member of ", who, L" must be a vector, as it can receive multiple values." };
+	}
+	inline void ValidateOption(const arger::Config& config, detail::ValidOption& entry, detail::ValidConfig& state) {
+		const arger::Option& option = *entry.option;
+		size_t index = size_t(&entry - state.options.data());
 		entry.payload = !option.payload.name.empty();
 
+		/* the root and all groups can be users of the option */
+		entry.users.assign(state.groups.capacity() + 1, false);
+
 		/* check if the abbreviation is unique */
 		if (option.abbreviation != 0) {
-			if (state.abbreviations.contains(option.abbreviation))
+			if (detail::FindAbbreviation(state, option.abbreviation) != 0)
 				throw arger::ConfigException{ L"Option abbreviation [", option.abbreviation, L"] already exists." };
-			state.abbreviations[option.abbreviation] = &entry;
+			if (size_t(option.abbreviation) < detail::NumAsciiAbbreviations)
+				state.asciiAbbreviations[size_t(option.abbreviation)] = index;
+			else
+				state.abbreviations[option.abbreviation] = index;
 		}
 
+		/* configure the limits (lists limit the number of values, and are therefore unlimited by default) */
+		entry.minimum = option.require.minimum.value_or(0);
+		if (option.require.maximum.has_value())
+			entry.maximum = (*option.require.maximum == 0 ? 0 : std::max<size_t>(entry.minimum, *option.require.maximum));
+		else
+			entry.maximum = (option.separator != 0 ? 0 : std::max<size_t>(entry.minimum, 1));
+
+		/* check if the remaining attributes have already been validated at compile-time */
+		if (state.trusted)
+			return;
+
 		/* validate the special-purpose attributes */
 		std::wstring whoSelf = str::wd::Build(L"option [", option.name, L']');
 		ValidateFlags(config, option, whoSelf, entry.payload);
@@ -117,13 +200,6 @@ namespace arger::detail {
 		if (entry.payload)
 			detail::ValidateType(option.payload.type, whoSelf);
 
-		/* configure the limits */
-		entry.minimum = option.require.minimum.value_or(0);
-		if (option.require.maximum.has_value())
-			entry.maximum = (*option.require.maximum == 0 ? 0 : std::max<size_t>(entry.minimum, *option.require.maximum));
-		else
-			entry.maximum = std::max<size_t>(entry.minimum, 1);
-
 		/* validate the default-values */
 		if (entry.payload && !option.payload.defValue.empty()) {
 			if (option.payload.defValue.size() < entry.minimum)
@@ -133,77 +209,71 @@ namespace arger::detail {
 			for (const auto& value : option.payload.defValue)
 				detail::ValidateDefValue(option.payload.type, value, whoSelf);
 		}
+
+		/* validate the bound member and packing */
+		detail::ValidateBinding(option.binding, (entry.payload ? &option.payload.type : 0), (entry.payload && entry.maximum != 1), whoSelf);
+		if (option.packed && (!entry.payload || !detail::IsNumeric(option.payload.type)))
+			throw arger::ConfigException{ L"Packed ", whoSelf, L" must carry an unsigned, signed, or real payload." };
+		if (option.packed && option.binding.convert)
+			throw arger::ConfigException{ L"Packed ", whoSelf, L" cannot be bound." };
+
+		/* validate the list separator (must be ascii, as it is compared per code-unit in the original encoding of the arguments) */
+		if (option.separator != 0 && !entry.payload)
+			throw arger::ConfigException{ L"List ", whoSelf, L" must carry a payload." };
+		if (option.separator != 0 && (option.separator <= 0x20 || option.separator >= 0x7f))
+			throw arger::ConfigException{ L"Separator of ", whoSelf, L" must be a printable ascii character." };
 	}
-	inline void ValidateGroup(const arger::Config& config, const arger::Group& group, detail::ValidConfig& state, detail::ValidGroup* parent, detail::ValidArguments* super) {
-		if (group.name.empty())
-			throw arger::ConfigException{ L"Group name must not be empty." };
-		if (group.name.starts_with(L"-"))
-			throw arger::ConfigException{ L"Group name must not start with a hypen." };
+	inline void ValidateGroup(const arger::Config& config, detail::ValidGroup& entry, detail::ValidConfig& state, detail::ValidGroup* parent, detail::ValidArguments* super) {
+		const arger::Group& group = *entry.group;
 		const std::wstring& id = (group.id.empty() ? group.name : group.id);
-
-		/* validate the name's uniqueness */
-		if (super->sub.contains(group.name))
-			throw arger::ConfigException{ L"Group with name [", group.name, L"] already exists for given groups-set." };
-		detail::ValidGroup& entry = super->sub[group.name];
-		entry.group = &group;
 		entry.id = id;
 		entry.parent = parent;
 		entry.super = super;
 
-		/* validate the special-purpose attributes */
-		if (group.flagHelp || group.flagVersion) {
-			ValidateFlags(config, group, str::wd::Build(L"Group with id [", id, L']'), !group.positionals.empty() || !group.groups.list.empty());
-			if (parent != 0)
-				throw arger::ConfigException{ L"Group with id [", id, L"] can only have a help special purpose flag assigned if its a root group." };
-		}
-
-		/* validate the arguments */
-		detail::ValidateArguments(config, group, state, entry, &entry, super);
-
-		/* check if the group-id is unique (only necessary if it does not contain sub-groups itself) */
-		if (!entry.incomplete) {
-			if (state.groupIds.contains(id))
-				throw arger::ConfigException{ L"Group with id [", id, L"] already exists." };
-			state.groupIds[id] = &entry;
-		}
-		else
-			entry.id = {};
-
-		/* validate the usages and register this group and all parents to them */
+		/* validate the usages and register this group and all parents to them (must happen before the
+		*	sub-groups are validated, as they rely on the usages of their parents to be defined) */
 		for (const auto& option : entry.group->use) {
-			auto it = state.options.find(option);
-			if (it == state.options.end())
-				throw arger::ConfigException{ L"Group [", entry.id, L"] uses undefined option [", option, L"]." };
+			const detail::ValidOption* found = detail::FindOption(state, option);
+			if (found == 0)
+				throw arger::ConfigException{ L"Group [", id, L"] uses undefined option [", option, L"]." };
 
+			std::vector<bool>& users = state.options[found - state.options.data()].users;
 			const detail::ValidGroup* walker = &entry;
 			while (walker != 0) {
-				it->second.users.insert(walker);
+				users[walker->index] = true;
 				walker = walker->parent;
 			}
 		}
 
-		/* register this group to all options used by parents of this group */
+		/* register this group to all options used by parents of this group (already validated by the parents) */
 		const detail::ValidGroup* walker = entry.parent;
 		while (walker != 0) {
 			for (const auto& option : walker->group->use)
-				state.options.at(option).users.insert(&entry);
+				state.options[detail::FindOption(state, option) - state.options.data()].users[entry.index] = true;
 			walker = walker->parent;
 		}
 
-		/* validate the help attributes */
-		detail::ValidateHelp(group, str::wd::Build(L"group [", id, L"]"));
+		/* validate the arguments */
+		detail::ValidateArguments(config, group, state, entry, &entry, super);
+
+		/* check if the group-id is unique (only necessary if it does not contain sub-groups itself) */
+		if (!entry.incomplete) {
+			if (state.groupIds.contains(id))
+				throw arger::ConfigException{ L"Group with id [", id, L"] already exists." };
+			state.groupIds[id] = &entry;
+		}
+		else
+			entry.id = {};
+
+		/* validate the content of the group, unless it is deferred until the group is selected */
+		if (!state.lazy)
+			detail::ValidateDeferred(config, entry, &entry, state.trusted);
 	}
 	inline void ValidateArguments(const arger::Config& config, const detail::Arguments& arguments, detail::ValidConfig& state, detail::ValidArguments& entry, detail::ValidGroup* self, detail::ValidArguments* super) {
 		entry.args = &arguments;
 		entry.incomplete = !arguments.groups.list.empty();
 		entry.nestedPositionals = !arguments.positionals.empty();
 
-		/* validate and configure the group name */
-		if (arguments.groups.name.empty())
-			entry.groupName = L"mode";
-		else
-			entry.groupName = str::View{ arguments.groups.name }.lower();
-
 		/* validate the groups */
 		if (entry.incomplete && !arguments.positionals.empty()) {
 			if (self == 0)
@@ -211,10 +281,57 @@ namespace arger::detail {
 			throw arger::ConfigException{ L"Group [", self->id, L"] cannot have positional arguments and sub-groups." };
 		}
 		if (entry.incomplete) {
-			for (const auto& sub : arguments.groups.list)
+			/* allocate all sub-groups adjacent to each other and sorted by name (space has been reserved upfront, which ensures the references remain valid) */
+			size_t first = state.groups.size();
+			for (const auto& sub : arguments.groups.list) {
+				if (sub.name.empty())
+					throw arger::ConfigException{ L"Group name must not be empty." };
+				if (sub.name.starts_with(L"-"))
+					throw arger::ConfigException{ L"Group name must not start with a hypen." };
+				state.groups.emplace_back().group = &sub;
+				state.groups.back().index = state.groups.size();
+			}
+			entry.sub = std::span<detail::ValidGroup>{ state.groups.data() + first, state.groups.size() - first };
+			std::sort(entry.sub.begin(), entry.sub.end(), [](const detail::ValidGroup& a, const detail::ValidGroup& b) { return a.group->name < b.group->name; });
+
+			/* validate the name's uniqueness, assign the final dense indices, and setup the name lookup */
+			std::vector<std::wstring_view> names;
+			for (size_t i = 0; i < entry.sub.size(); ++i) {
+				if (i > 0 && entry.sub[i - 1].group->name == entry.sub[i].group->name)
+					throw arger::ConfigException{ L"Group with name [", entry.sub[i].group->name, L"] already exists for given groups-set." };
+				entry.sub[i].index = first + i + 1;
+				names.push_back(entry.sub[i].group->name);
+			}
+			entry.subNames.build(names);
+
+			for (auto& sub : entry.sub)
 				detail::ValidateGroup(config, sub, state, self, (self == 0 ? super : self));
 			for (const auto& sub : entry.sub)
-				entry.nestedPositionals = (entry.nestedPositionals || sub.second.nestedPositionals);
+				entry.nestedPositionals = (entry.nestedPositionals || sub.nestedPositionals);
+		}
+	}
+	inline void ValidateDeferred(const arger::Config& config, detail::ValidArguments& entry, detail::ValidGroup* self, bool trusted) {
+		const detail::Arguments& arguments = *entry.args;
+		if (entry.validated)
+			return;
+
+		/* validate and configure the group name */
+		if (arguments.groups.name.empty())
+			entry.groupName = L"mode";
+		else
+			entry.groupName = str::View{ arguments.groups.name }.lower();
+
+		/* validate the special-purpose and help attributes of the group */
+		if (self != 0 && !trusted) {
+			if (self->group->flagHelp || self->group->flagVersion) {
+				ValidateFlags(config, *self->group, str::wd::Build(L"Group with id [", self->id, L']'), !arguments.positionals.empty() || !arguments.groups.list.empty());
+				if (self->parent != 0)
+					throw arger::ConfigException{ L"Group with id [", self->id, L"] can only have a help special purpose flag assigned if its a root group." };
+			}
+			detail::ValidateHelp(*self->group, str::wd::Build(L"group [", self->id, L"]"));
+		}
+		if (entry.incomplete) {
+			entry.validated = true;
 			return;
 		}
 
@@ -225,6 +342,12 @@ namespace arger::detail {
 		else
 			entry.maximum = std::max<size_t>(entry.minimum, arguments.positionals.size());
 
+		/* check if the positionals have already been validated at compile-time */
+		if (trusted) {
+			entry.validated = true;
+			return;
+		}
+
 		/* validate the positionals */
 		for (size_t i = 0; i < arguments.positionals.size(); ++i) {
 			/* validate the name and type */
@@ -236,28 +359,125 @@ namespace arger::detail {
 			/* validate the default-value */
 			if (arguments.positionals[i].defValue.has_value())
 				detail::ValidateDefValue(arguments.positionals[i].type, arguments.positionals[i].defValue.value(), whoSelf);
+
+			/* validate the bound member (the last positional receives all remaining arguments) */
+			bool catchAll = (i + 1 == arguments.positionals.size() && (entry.maximum == 0 || entry.maximum > arguments.positionals.size()));
+			detail::ValidateBinding(arguments.positionals[i].binding, &arguments.positionals[i].type, catchAll, whoSelf);
+
+			/* validate the packing of the catch-all positional */
+			if (catchAll && arguments.packed && (!detail::IsNumeric(arguments.positionals[i].type) || arguments.positionals[i].binding.convert))
+				throw arger::ConfigException{ L"Packed ", whoSelf, L" must be unbound and of type unsigned, signed, or real." };
 		}
+		if (arguments.packed && (arguments.positionals.empty() || (entry.maximum != 0 && entry.maximum <= arguments.positionals.size())))
+			throw arger::ConfigException{ L"Packed ", (self == 0 ? L"arguments" : str::wd::Build(L"group [", self->id, L"]")), L" must have a catch-all positional." };
+		entry.validated = true;
 	}
-	inline void ValidateConfig(const arger::Config& config, detail::ValidConfig& state, bool menu) {
-		if (menu && !config.program.empty())
-			throw arger::ConfigException{ L"Menu cannot have a program name." };
-		if (!menu && config.program.empty())
-			throw arger::ConfigException{ L"Configuration must have a program name." };
+	inline void ValidateConfig(const arger::Config& config, detail::ValidConfig& state, bool menu, bool lazy, bool trusted) {
 		state.config = &config;
+		state.lazy = lazy;
+		state.trusted = trusted;
 
-		/* validate the help attributes */
-		detail::ValidateHelp(config, L"arguments");
+		/* validate the program name and help attributes (unless already validated at compile-time) */
+		if (!trusted) {
+			if (menu && !config.program.empty())
+				throw arger::ConfigException{ L"Menu cannot have a program name." };
+			if (!menu && config.program.empty())
+				throw arger::ConfigException{ L"Configuration must have a program name." };
+			detail::ValidateHelp(config, L"arguments");
+		}
+
+		/* reserve the space for all groups upfront, as they are referenced by pointers */
+		state.groups.reserve(detail::CountGroups(config));
+		state.asciiAbbreviations.fill(detail::NoAbbreviation);
+
+		/* setup the options sorted by name and validate the names */
+		for (const auto& option : config.options) {
+			if (option.name.empty())
+				throw arger::ConfigException{ L"Option name must not be empty." };
+			if (option.name.starts_with(L"-"))
+				throw arger::ConfigException{ L"Option name must not start with a hypen." };
+			state.options.emplace_back().option = &option;
+		}
+		std::sort(state.options.begin(), state.options.end(), [](const detail::ValidOption& a, const detail::ValidOption& b) { return a.option->name < b.option->name; });
+		std::shared_ptr<detail::OptionIds> ids = std::make_shared<detail::OptionIds>();
+		for (size_t i = 0; i < state.options.size(); ++i) {
+			if (i > 0 && state.options[i - 1].option->name == state.options[i].option->name)
+				throw arger::ConfigException{ L"Option with name [", state.options[i].option->name, L"] already exists." };
+			ids->names.push_back(state.options[i].option->name);
+			const arger::Option& option = *state.options[i].option;
+			ids->packed.push_back((option.packed && detail::IsNumeric(option.payload.type)) ? std::get<arger::Primitive>(option.payload.type) : arger::Primitive::any);
+		}
+		ids->table.build({ ids->names.begin(), ids->names.end() });
+		state.optionIds = ids;
 
 		/* validate the options and arguments (validate the options before the arguments,
 		*	as the arguments-usages will require the options to be already set) */
-		for (const auto& option : config.options)
+		for (auto& option : state.options)
 			detail::ValidateOption(config, option, state);
 		detail::ValidateArguments(config, config, state, state, 0, &state);
+		detail::ValidateDeferred(config, state, 0, trusted);
 
 		/* finalize the options by adding the null-group */
 		for (auto& option : state.options) {
-			option.second.restricted = !option.second.users.empty();
-			option.second.users.insert(0);
+			option.restricted = (std::find(option.users.begin(), option.users.end(), true) != option.users.end());
+			option.users[0] = true;
 		}
 	}
 }
+
+namespace arger {
+	/* pre-validated configuration, which can be passed to the parsing functions repeatedly without re-validating it
+	*	Note: The configuration is only referenced and must therefore outlive the compiled configuration
+	*	Note: If lazy, only the global structure (options, abbreviations, group names/ids and usages) is validated upfront,
+	*		while the content of groups is validated once the group is first selected while parsing (which can therefore
+	*		result in an arger::ConfigException while parsing, and is serialized, in order to be parsed from multiple threads) */
+	class CompiledConfig {
+		template <class ChType>
+		friend class detail::Parser;
+		template <const arger::StaticConfig& Config, bool Menu>
+		friend class arger::StaticCompiled;
+		friend class arger::CompiledImage;
+	private:
+		mutable detail::ValidConfig pValid;
+		mutable std::mutex pDeferred;
+		bool pMenu = false;
+
+	private:
+		/* only setup the layout of the configuration, without validating it (must have been validated by arger::StaticValidate or arger::SaveImage) */
+		CompiledConfig(const arger::Config& config, bool menu, bool lazy, bool trusted) : pMenu{ menu } {
+			detail::ValidateConfig(config, pValid, menu, lazy, trusted);
+		}
+
+	private:
+		/* validate the deferred content of the selected group (the only modification after construction, which
+		*	is therefore guarded, as the same compiled configuration might be parsed by multiple threads) */
+		void fValidateDeferred(const detail::ValidGroup& group) const {
+			if (!pValid.lazy)
+				return;
+			std::lock_guard<std::mutex> lock{ pDeferred };
+			detail::ValidGroup& selected = pValid.groups[group.index - 1];
+			detail::ValidateDeferred(*pValid.config, selected, &selected, pValid.trusted);
+		}
+
+	public:
+		CompiledConfig(const arger::Config& config, bool menu, bool lazy = false) : pMenu{ menu } {
+			detail::ValidateConfig(config, pValid, menu, lazy, false);
+		}
+		CompiledConfig(arger::Config&&, bool, bool = false) = delete;
+		CompiledConfig(arger::CompiledConfig&&) = delete;
+		CompiledConfig(const arger::CompiledConfig&) = delete;
+		arger::CompiledConfig& operator=(arger::CompiledConfig&&) = delete;
+		arger::CompiledConfig& operator=(const arger::CompiledConfig&) = delete;
+
+	public:
+		constexpr const arger::Config& config() const {
+			return *pValid.config;
+		}
+		constexpr bool menu() const {
+			return pMenu;
+		}
+		arger::OptionId id(const std::wstring_view& name) const {
+			return arger::OptionId{ pValid.optionIds->table.find(name) };
+		}
+	};
+}
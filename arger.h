@@ -3,16 +3,93 @@
 #pragma once
 
 #include "arger-common.h"
+#include "arger-enum.h"
 #include "arger-config.h"
 #include "arger-parsed.h"
 #include "arger-parser.h"
 #include "arger-verify.h"
 #include "arger-help.h"
+#include "arger-simd.h"
+#include "arger-static.h"
+#include "arger-image.h"
+#include "arger-gen.h"
+#include "arger-json.h"
 
 namespace arger {
+	namespace detail {
+		/* reference the arguments in their original encoding (only the strings, which are actually stored or looked up, are widened) */
+		template <class ChType>
+		inline std::vector<std::basic_string_view<ChType>> ArgumentViews(int argc, const ChType* const* argv) {
+			std::vector<std::basic_string_view<ChType>> args;
+			args.reserve(size_t(std::max<int>(argc, 0)));
+			for (size_t i = 0; i < argc; ++i)
+				args.emplace_back(argv[i]);
+			return args;
+		}
+	}
+
+	/* arguments transcoded into a single contiguous wide-character buffer, which are referenced as views into the buffer
+	*	(utf-8 arguments are decoded in bulk, and malformed utf-8 results in an arger::ParsingException being thrown) */
+	class PreparedArgs {
+	private:
+		std::unique_ptr<wchar_t[]> pBuffer;
+		std::vector<std::wstring_view> pArgs;
+
+	public:
+		PreparedArgs() = default;
+		template <str::IsChar ChType>
+		PreparedArgs(int argc, const ChType* const* argv) {
+			size_t count = size_t(std::max<int>(argc, 0)), total = 0;
+			std::vector<size_t> sizes(count);
+
+			/* size the buffer up front (every input character results in at most one wide character, except
+			*	for 32-bit inputs with 16-bit wide characters, which might require surrogate-pairs) */
+			for (size_t i = 0; i < count; ++i)
+				total += (sizes[i] = std::char_traits<ChType>::length(argv[i]));
+			if constexpr (sizeof(ChType) > sizeof(wchar_t))
+				total *= 2;
+			pBuffer = std::make_unique_for_overwrite<wchar_t[]>(total);
+
+			/* transcode all arguments into the buffer */
+			size_t offset = 0;
+			for (size_t i = 0; i < count; ++i) {
+				if constexpr (std::is_same_v<ChType, wchar_t>)
+					std::copy(argv[i], argv[i] + sizes[i], pBuffer.get() + offset);
+				else if constexpr (sizeof(ChType) == 1)
+					sizes[i] = detail::DecodeUtf8(reinterpret_cast<const uint8_t*>(argv[i]), sizes[i], pBuffer.get() + offset, i);
+				else {
+					std::wstring temp = str::wd::To(std::basic_string_view<ChType>{ argv[i], sizes[i] });
+					std::copy(temp.begin(), temp.end(), pBuffer.get() + offset);
+					sizes[i] = temp.size();
+				}
+				offset += sizes[i];
+			}
+
+			/* setup the views into the final buffer */
+			pArgs.reserve(count);
+			offset = 0;
+			for (size_t i = 0; i < count; ++i) {
+				pArgs.emplace_back(pBuffer.get() + offset, sizes[i]);
+				offset += sizes[i];
+			}
+		}
+
+	public:
+		const std::vector<std::wstring_view>& args() const {
+			return pArgs;
+		}
+		size_t size() const {
+			return pArgs.size();
+		}
+		std::wstring_view operator[](size_t index) const {
+			return pArgs[index];
+		}
+	};
+
 	/* convenience function to prepare the arguments */
 	inline std::vector<std::wstring> Prepare(int argc, const str::IsChar auto* const* argv) {
 		std::vector<std::wstring> args;
+		args.reserve(size_t(std::max<int>(argc, 0)));
 		for (size_t i = 0; i < argc; ++i)
 			args.push_back(str::wd::To(argv[i]));
 		return args;
@@ -26,6 +103,17 @@ namespace arger {
 		wchar_t inStr = 0;
 		bool lastWhitespace = true;
 		for (size_t i = 0; i < view.size(); ++i) {
+			/* copy the entire run of regular characters at once (cannot be whitespace, quotes, or escapes) */
+			size_t end = detail::FindTokenSpecial(view.data(), view.size(), i);
+			if (end > i) {
+				if (lastWhitespace)
+					args.emplace_back();
+				lastWhitespace = false;
+				args.back().append(view.begin() + i, view.begin() + end);
+				if ((i = end) >= view.size())
+					break;
+			}
+
 			/* check if the character is whitespace and a new argument needs to be
 			*	started or if it can just be written out, as its part of a string */
 			if (std::iswspace(view[i])) {
@@ -70,13 +158,25 @@ namespace arger {
 	inline constexpr std::wstring HelpHint(int argc, const str::IsChar auto* const* argv, const arger::Config& config) {
 		return arger::HelpHint({ str::wd::To(argc == 0 ? "" : argv[0]) }, config);
 	}
+	inline constexpr std::wstring HelpHint(const str::IsStr auto& line, const arger::CompiledConfig& config) {
+		return arger::HelpHint(line, config.config());
+	}
+	inline constexpr std::wstring HelpHint(int argc, const str::IsChar auto* const* argv, const arger::CompiledConfig& config) {
+		return arger::HelpHint(argc, argv, config.config());
+	}
 
 	/* convenience functions for standard program arguments parsing */
 	inline arger::Parsed Parse(const str::IsStr auto& line, const arger::Config& config) {
 		return arger::Parse(arger::Prepare(line), config);
 	}
 	inline arger::Parsed Parse(int argc, const str::IsChar auto* const* argv, const arger::Config& config) {
-		return arger::Parse(arger::Prepare(argc, argv), config);
+		return detail::ParseViews(detail::ArgumentViews(argc, argv), arger::CompiledConfig{ config, false }, false, false);
+	}
+	inline arger::Parsed Parse(const str::IsStr auto& line, const arger::CompiledConfig& config) {
+		return arger::Parse(arger::Prepare(line), config);
+	}
+	inline arger::Parsed Parse(int argc, const str::IsChar auto* const* argv, const arger::CompiledConfig& config) {
+		return detail::ParseViews(detail::ArgumentViews(argc, argv), config, false, false);
 	}
 
 	/* convenience functions for menu-input arguments parsing */
@@ -84,6 +184,84 @@ namespace arger {
 		return arger::Menu(arger::Prepare(line), config);
 	}
 	inline arger::Parsed Menu(int argc, const str::IsChar auto* const* argv, const arger::Config& config) {
-		return arger::Menu(arger::Prepare(argc, argv), config);
+		return detail::ParseViews(detail::ArgumentViews(argc, argv), arger::CompiledConfig{ config, true }, true, false);
+	}
+	inline arger::Parsed Menu(const str::IsStr auto& line, const arger::CompiledConfig& config) {
+		return arger::Menu(arger::Prepare(line), config);
+	}
+	inline arger::Parsed Menu(int argc, const str::IsChar auto* const* argv, const arger::CompiledConfig& config) {
+		return detail::ParseViews(detail::ArgumentViews(argc, argv), config, true, false);
+	}
+
+	/* convenience functions for parsing into bound members of the target (see arger::Bind) */
+	inline arger::Parsed Parse(const str::IsStr auto& line, const arger::Config& config, auto& target) {
+		return arger::Parse(arger::Prepare(line), config, target);
+	}
+	inline arger::Parsed Parse(int argc, const str::IsChar auto* const* argv, const arger::Config& config, auto& target) {
+		return detail::ParseViews(detail::ArgumentViews(argc, argv), arger::CompiledConfig{ config, false }, false, false, detail::MakeTarget(target));
+	}
+	inline arger::Parsed Parse(const str::IsStr auto& line, const arger::CompiledConfig& config, auto& target) {
+		return arger::Parse(arger::Prepare(line), config, target);
+	}
+	inline arger::Parsed Parse(int argc, const str::IsChar auto* const* argv, const arger::CompiledConfig& config, auto& target) {
+		return detail::ParseViews(detail::ArgumentViews(argc, argv), config, false, false, detail::MakeTarget(target));
+	}
+	inline arger::Parsed Menu(const str::IsStr auto& line, const arger::Config& config, auto& target) {
+		return arger::Menu(arger::Prepare(line), config, target);
+	}
+	inline arger::Parsed Menu(int argc, const str::IsChar auto* const* argv, const arger::Config& config, auto& target) {
+		return detail::ParseViews(detail::ArgumentViews(argc, argv), arger::CompiledConfig{ config, true }, true, false, detail::MakeTarget(target));
+	}
+	inline arger::Parsed Menu(const str::IsStr auto& line, const arger::CompiledConfig& config, auto& target) {
+		return arger::Menu(arger::Prepare(line), config, target);
+	}
+	inline arger::Parsed Menu(int argc, const str::IsChar auto* const* argv, const arger::CompiledConfig& config, auto& target) {
+		return detail::ParseViews(detail::ArgumentViews(argc, argv), config, true, false, detail::MakeTarget(target));
+	}
+
+	/* convenience functions for borrowed standard program arguments parsing (see arger::ParseBorrowed) */
+	inline arger::Parsed ParseBorrowed(int argc, const str::IsChar auto* const* argv, const arger::Config& config) {
+		return detail::ParseViews(detail::ArgumentViews(argc, argv), arger::CompiledConfig{ config, false }, false, true);
+	}
+	inline arger::Parsed ParseBorrowed(int argc, const str::IsChar auto* const* argv, const arger::CompiledConfig& config) {
+		return detail::ParseViews(detail::ArgumentViews(argc, argv), config, false, true);
+	}
+
+	/* convenience functions for borrowed menu-input arguments parsing (see arger::ParseBorrowed) */
+	inline arger::Parsed MenuBorrowed(int argc, const str::IsChar auto* const* argv, const arger::Config& config) {
+		return detail::ParseViews(detail::ArgumentViews(argc, argv), arger::CompiledConfig{ config, true }, true, true);
+	}
+	inline arger::Parsed MenuBorrowed(int argc, const str::IsChar auto* const* argv, const arger::CompiledConfig& config) {
+		return detail::ParseViews(detail::ArgumentViews(argc, argv), config, true, true);
+	}
+
+	/* convenience functions for parsing prepared arguments (borrowed values reference the buffer of the prepared arguments) */
+	inline arger::Parsed Parse(const arger::PreparedArgs& args, const arger::Config& config) {
+		return detail::ParseViews<wchar_t>(std::vector<std::wstring_view>{ args.args() }, arger::CompiledConfig{ config, false }, false, false);
+	}
+	inline arger::Parsed Parse(const arger::PreparedArgs& args, const arger::CompiledConfig& config) {
+		return detail::ParseViews<wchar_t>(std::vector<std::wstring_view>{ args.args() }, config, false, false);
+	}
+	inline arger::Parsed Menu(const arger::PreparedArgs& args, const arger::Config& config) {
+		return detail::ParseViews<wchar_t>(std::vector<std::wstring_view>{ args.args() }, arger::CompiledConfig{ config, true }, true, false);
+	}
+	inline arger::Parsed Menu(const arger::PreparedArgs& args, const arger::CompiledConfig& config) {
+		return detail::ParseViews<wchar_t>(std::vector<std::wstring_view>{ args.args() }, config, true, false);
+	}
+	inline arger::Parsed ParseBorrowed(const arger::PreparedArgs& args, const arger::Config& config) {
+		return detail::ParseViews<wchar_t>(std::vector<std::wstring_view>{ args.args() }, arger::CompiledConfig{ config, false }, false, true);
+	}
+	inline arger::Parsed ParseBorrowed(const arger::PreparedArgs& args, const arger::CompiledConfig& config) {
+		return detail::ParseViews<wchar_t>(std::vector<std::wstring_view>{ args.args() }, config, false, true);
+	}
+	inline arger::Parsed MenuBorrowed(const arger::PreparedArgs& args, const arger::Config& config) {
+		return detail::ParseViews<wchar_t>(std::vector<std::wstring_view>{ args.args() }, arger::CompiledConfig{ config, true }, true, true);
+	}
+	inline arger::Parsed MenuBorrowed(const arger::PreparedArgs& args, const arger::CompiledConfig& config) {
+		return detail::ParseViews<wchar_t>(std::vector<std::wstring_view>{ args.args() }, config, true, true);
 	}
+	arger::Parsed ParseBorrowed(arger::PreparedArgs&& args, const arger::Config& config) = delete;
+	arger::Parsed ParseBorrowed(arger::PreparedArgs&& args, const arger::CompiledConfig& config) = delete;
+	arger::Parsed MenuBorrowed(arger::PreparedArgs&& args, const arger::Config& config) = delete;
+	arger::Parsed MenuBorrowed(arger::PreparedArgs&& args, const arger::CompiledConfig& config) = delete;
 }